@@ -0,0 +1,532 @@
+/*****
+ * This file is automatically generated by findsym.pl
+ * Changes will be overwritten.
+ *****/
+
+// If the ADDSYMBOL macro is not already defined, define it with the default
+// purpose of referring to an external pre-translated symbol, such that
+// SYM(name) also refers to that symbol.
+#ifndef ADDSYMBOL
+    #define ADDSYMBOL(name) extern sym::symbol PRETRANSLATED_SYMBOL_##name
+    #define SYM(name) PRETRANSLATED_SYMBOL_##name
+#endif
+
+ADDSYMBOL(AND);
+ADDSYMBOL(AtA);
+ADDSYMBOL(CLZ);
+ADDSYMBOL(CTZ);
+ADDSYMBOL(Ceil);
+ADDSYMBOL(Cos);
+ADDSYMBOL(Degrees);
+ADDSYMBOL(Floor);
+ADDSYMBOL(Jn);
+ADDSYMBOL(NOT);
+ADDSYMBOL(OR);
+ADDSYMBOL(Round);
+ADDSYMBOL(Sin);
+ADDSYMBOL(Tan);
+ADDSYMBOL(VERSION);
+ADDSYMBOL(XOR);
+ADDSYMBOL(Yn);
+ADDSYMBOL(_begingroup3);
+ADDSYMBOL(_bsp);
+ADDSYMBOL(_cputime);
+ADDSYMBOL(_draw);
+ADDSYMBOL(_eval);
+ADDSYMBOL(_findroot);
+ADDSYMBOL(_image);
+ADDSYMBOL(_labelpath);
+ADDSYMBOL(_projection);
+ADDSYMBOL(_sample);
+ADDSYMBOL(_shadesurface);
+ADDSYMBOL(_strokepath);
+ADDSYMBOL(_texpath);
+ADDSYMBOL(a);
+ADDSYMBOL(aCos);
+ADDSYMBOL(aSin);
+ADDSYMBOL(aTan);
+ADDSYMBOL(abort);
+ADDSYMBOL(abs);
+ADDSYMBOL(acc);
+ADDSYMBOL(accel);
+ADDSYMBOL(acos);
+ADDSYMBOL(acosh);
+ADDSYMBOL(add);
+ADDSYMBOL(adjust);
+ADDSYMBOL(alias);
+ADDSYMBOL(align);
+ADDSYMBOL(all);
+ADDSYMBOL(ambient);
+ADDSYMBOL(angle);
+ADDSYMBOL(animate);
+ADDSYMBOL(antialias);
+ADDSYMBOL(append);
+ADDSYMBOL(arclength);
+ADDSYMBOL(arctime);
+ADDSYMBOL(args);
+ADDSYMBOL(argsort);
+ADDSYMBOL(array);
+ADDSYMBOL(ascii);
+ADDSYMBOL(asin);
+ADDSYMBOL(asinh);
+ADDSYMBOL(assert);
+ADDSYMBOL(asydir);
+ADDSYMBOL(async);
+ADDSYMBOL(atLeast);
+ADDSYMBOL(atan);
+ADDSYMBOL(atan2);
+ADDSYMBOL(atanh);
+ADDSYMBOL(atbreakpoint);
+ADDSYMBOL(atexit);
+ADDSYMBOL(atleast);
+ADDSYMBOL(atupdate);
+ADDSYMBOL(axialshade);
+ADDSYMBOL(azimuth);
+ADDSYMBOL(b);
+ADDSYMBOL(background);
+ADDSYMBOL(basealign);
+ADDSYMBOL(beginclip);
+ADDSYMBOL(begingroup);
+ADDSYMBOL(bezier);
+ADDSYMBOL(bezierP);
+ADDSYMBOL(bezierPP);
+ADDSYMBOL(bezierPPP);
+ADDSYMBOL(blend);
+ADDSYMBOL(breakpoint);
+ADDSYMBOL(breakpoints);
+ADDSYMBOL(byte);
+ADDSYMBOL(c);
+ADDSYMBOL(c0);
+ADDSYMBOL(c1);
+ADDSYMBOL(camera);
+ADDSYMBOL(cbrt);
+ADDSYMBOL(cd);
+ADDSYMBOL(ceil);
+ADDSYMBOL(center);
+ADDSYMBOL(change2);
+ADDSYMBOL(check);
+ADDSYMBOL(choose);
+ADDSYMBOL(ci);
+ADDSYMBOL(clear);
+ADDSYMBOL(clip);
+ADDSYMBOL(close);
+ADDSYMBOL(closed);
+ADDSYMBOL(cmyk);
+ADDSYMBOL(colatitude);
+ADDSYMBOL(colorless);
+ADDSYMBOL(colors);
+ADDSYMBOL(colorspace);
+ADDSYMBOL(columns);
+ADDSYMBOL(comment);
+ADDSYMBOL(complement);
+ADDSYMBOL(compression);
+ADDSYMBOL(concat);
+ADDSYMBOL(conj);
+ADDSYMBOL(controlSpecifier);
+ADDSYMBOL(convert);
+ADDSYMBOL(copy);
+ADDSYMBOL(cos);
+ADDSYMBOL(cosh);
+ADDSYMBOL(crfft);
+ADDSYMBOL(cross);
+ADDSYMBOL(csv);
+ADDSYMBOL(cubicroots);
+ADDSYMBOL(curlSpecifier);
+ADDSYMBOL(currentpen);
+ADDSYMBOL(cyclic);
+ADDSYMBOL(d);
+ADDSYMBOL(data);
+ADDSYMBOL(deconstruct);
+ADDSYMBOL(defaultpen);
+ADDSYMBOL(deg);
+ADDSYMBOL(degrees);
+ADDSYMBOL(delete);
+ADDSYMBOL(deletepreamble);
+ADDSYMBOL(depth);
+ADDSYMBOL(dest);
+ADDSYMBOL(determinant);
+ADDSYMBOL(diagonal);
+ADDSYMBOL(diffuse);
+ADDSYMBOL(digits);
+ADDSYMBOL(dimension);
+ADDSYMBOL(dir);
+ADDSYMBOL(dirSpecifier);
+ADDSYMBOL(dirtime);
+ADDSYMBOL(divisor);
+ADDSYMBOL(dobreak);
+ADDSYMBOL(dot);
+ADDSYMBOL(downcase);
+ADDSYMBOL(draw);
+ADDSYMBOL(drawPRCcylinder);
+ADDSYMBOL(drawPRCdisk);
+ADDSYMBOL(drawPRCsphere);
+ADDSYMBOL(drawPRCtube);
+ADDSYMBOL(drawbeziertriangle);
+ADDSYMBOL(drawpixel);
+ADDSYMBOL(dval);
+ADDSYMBOL(dxmax);
+ADDSYMBOL(e);
+ADDSYMBOL(edges);
+ADDSYMBOL(embedded);
+ADDSYMBOL(empty);
+ADDSYMBOL(endclip);
+ADDSYMBOL(endgroup);
+ADDSYMBOL(endgroup3);
+ADDSYMBOL(eof);
+ADDSYMBOL(eol);
+ADDSYMBOL(erase);
+ADDSYMBOL(erf);
+ADDSYMBOL(erfc);
+ADDSYMBOL(error);
+ADDSYMBOL(exit);
+ADDSYMBOL(exp);
+ADDSYMBOL(expi);
+ADDSYMBOL(expm1);
+ADDSYMBOL(extenda);
+ADDSYMBOL(extendb);
+ADDSYMBOL(extension);
+ADDSYMBOL(f);
+ADDSYMBOL(fa);
+ADDSYMBOL(fabs);
+ADDSYMBOL(factorial);
+ADDSYMBOL(fb);
+ADDSYMBOL(fft);
+ADDSYMBOL(file);
+ADDSYMBOL(fill);
+ADDSYMBOL(fillrule);
+ADDSYMBOL(final);
+ADDSYMBOL(find);
+ADDSYMBOL(flatness);
+ADDSYMBOL(floor);
+ADDSYMBOL(flush);
+ADDSYMBOL(fmod);
+ADDSYMBOL(font);
+ADDSYMBOL(fontcommand);
+ADDSYMBOL(fontsize);
+ADDSYMBOL(format);
+ADDSYMBOL(fprime);
+ADDSYMBOL(frequency);
+ADDSYMBOL(from);
+ADDSYMBOL(functionshade);
+ADDSYMBOL(fuzz);
+ADDSYMBOL(g);
+ADDSYMBOL(gamma);
+ADDSYMBOL(generate_random_backtrace);
+ADDSYMBOL(getc);
+ADDSYMBOL(gouraudshade);
+ADDSYMBOL(granularity);
+ADDSYMBOL(gray);
+ADDSYMBOL(grestore);
+ADDSYMBOL(gsave);
+ADDSYMBOL(half);
+ADDSYMBOL(height);
+ADDSYMBOL(hex);
+ADDSYMBOL(history);
+ADDSYMBOL(hypot);
+ADDSYMBOL(i);
+ADDSYMBOL(identity);
+ADDSYMBOL(imports);
+ADDSYMBOL(in);
+ADDSYMBOL(incircle);
+ADDSYMBOL(inf);
+ADDSYMBOL(infinity);
+ADDSYMBOL(initial);
+ADDSYMBOL(initialized);
+ADDSYMBOL(input);
+ADDSYMBOL(insert);
+ADDSYMBOL(inside);
+ADDSYMBOL(insphere);
+ADDSYMBOL(intMax);
+ADDSYMBOL(intMin);
+ADDSYMBOL(intcolumn);
+ADDSYMBOL(interaction);
+ADDSYMBOL(interactive);
+ADDSYMBOL(interactivewrite);
+ADDSYMBOL(interp);
+ADDSYMBOL(intersect);
+ADDSYMBOL(intersections);
+ADDSYMBOL(inverse);
+ADDSYMBOL(invisible);
+ADDSYMBOL(is3D);
+ADDSYMBOL(isnan);
+ADDSYMBOL(iterations);
+ADDSYMBOL(j);
+ADDSYMBOL(justify);
+ADDSYMBOL(k);
+ADDSYMBOL(key);
+ADDSYMBOL(keys);
+ADDSYMBOL(knot);
+ADDSYMBOL(l);
+ADDSYMBOL(label);
+ADDSYMBOL(labels);
+ADDSYMBOL(latex);
+ADDSYMBOL(latitude);
+ADDSYMBOL(latticeshade);
+ADDSYMBOL(layer);
+ADDSYMBOL(ldexp);
+ADDSYMBOL(length);
+ADDSYMBOL(less);
+ADDSYMBOL(lights);
+ADDSYMBOL(line);
+ADDSYMBOL(linecap);
+ADDSYMBOL(linejoin);
+ADDSYMBOL(lineskip);
+ADDSYMBOL(linetype);
+ADDSYMBOL(linewidth);
+ADDSYMBOL(list);
+ADDSYMBOL(locale);
+ADDSYMBOL(locatefile);
+ADDSYMBOL(location);
+ADDSYMBOL(log);
+ADDSYMBOL(log10);
+ADDSYMBOL(log1p);
+ADDSYMBOL(longitude);
+ADDSYMBOL(m);
+ADDSYMBOL(magnification);
+ADDSYMBOL(makepen);
+ADDSYMBOL(map);
+ADDSYMBOL(max);
+ADDSYMBOL(max3);
+ADDSYMBOL(maxAfterTransform);
+ADDSYMBOL(maxbezier);
+ADDSYMBOL(maxbound);
+ADDSYMBOL(maxratio);
+ADDSYMBOL(maxtimes);
+ADDSYMBOL(mesh);
+ADDSYMBOL(microseconds);
+ADDSYMBOL(min);
+ADDSYMBOL(min3);
+ADDSYMBOL(minAfterTransform);
+ADDSYMBOL(minbezier);
+ADDSYMBOL(minbound);
+ADDSYMBOL(minratio);
+ADDSYMBOL(mintimes);
+ADDSYMBOL(miterlimit);
+ADDSYMBOL(mktemp);
+ADDSYMBOL(mode);
+ADDSYMBOL(n);
+ADDSYMBOL(name);
+ADDSYMBOL(nan);
+ADDSYMBOL(nativeformat);
+ADDSYMBOL(newpage);
+ADDSYMBOL(newton);
+ADDSYMBOL(ni);
+ADDSYMBOL(nib);
+ADDSYMBOL(nobreak);
+ADDSYMBOL(norm);
+ADDSYMBOL(normal);
+ADDSYMBOL(normalize);
+ADDSYMBOL(nowarn);
+ADDSYMBOL(nurb);
+ADDSYMBOL(nx);
+ADDSYMBOL(ny);
+ADDSYMBOL(nz);
+ADDSYMBOL(offset);
+ADDSYMBOL(opacity);
+ADDSYMBOL(orient);
+ADDSYMBOL(out);
+ADDSYMBOL(outname);
+ADDSYMBOL(output);
+ADDSYMBOL(overwrite);
+ADDSYMBOL(p);
+ADDSYMBOL(palette);
+ADDSYMBOL(path3);
+ADDSYMBOL(pattern);
+ADDSYMBOL(pdf);
+ADDSYMBOL(pena);
+ADDSYMBOL(penb);
+ADDSYMBOL(perm);
+ADDSYMBOL(perp);
+ADDSYMBOL(phi);
+ADDSYMBOL(pi);
+ADDSYMBOL(piecewisestraight);
+ADDSYMBOL(point);
+ADDSYMBOL(polar);
+ADDSYMBOL(pop);
+ADDSYMBOL(pos);
+ADDSYMBOL(position);
+ADDSYMBOL(post);
+ADDSYMBOL(postcontrol);
+ADDSYMBOL(postscript);
+ADDSYMBOL(pow10);
+ADDSYMBOL(prc);
+ADDSYMBOL(prcshininess);
+ADDSYMBOL(pre);
+ADDSYMBOL(preamble);
+ADDSYMBOL(precision);
+ADDSYMBOL(precontrol);
+ADDSYMBOL(prefetch);
+ADDSYMBOL(prefix);
+ADDSYMBOL(prepend);
+ADDSYMBOL(printBytecode);
+ADDSYMBOL(print_random_addresses);
+ADDSYMBOL(project);
+ADDSYMBOL(prompt);
+ADDSYMBOL(purge);
+ADDSYMBOL(push);
+ADDSYMBOL(q);
+ADDSYMBOL(quadraticroots);
+ADDSYMBOL(quotient);
+ADDSYMBOL(r);
+ADDSYMBOL(ra);
+ADDSYMBOL(radialshade);
+ADDSYMBOL(radians);
+ADDSYMBOL(radius);
+ADDSYMBOL(rand);
+ADDSYMBOL(randMax);
+ADDSYMBOL(rb);
+ADDSYMBOL(rcfft);
+ADDSYMBOL(read);
+ADDSYMBOL(readline);
+ADDSYMBOL(readrows);
+ADDSYMBOL(realDigits);
+ADDSYMBOL(realEpsilon);
+ADDSYMBOL(realMax);
+ADDSYMBOL(realMin);
+ADDSYMBOL(realcolumn);
+ADDSYMBOL(realmult);
+ADDSYMBOL(reflect);
+ADDSYMBOL(relativedistance);
+ADDSYMBOL(remainder);
+ADDSYMBOL(rename);
+ADDSYMBOL(replace);
+ADDSYMBOL(resetdefaultpen);
+ADDSYMBOL(reverse);
+ADDSYMBOL(rfind);
+ADDSYMBOL(rgb);
+ADDSYMBOL(rotate);
+ADDSYMBOL(round);
+ADDSYMBOL(s);
+ADDSYMBOL(saveline);
+ADDSYMBOL(scale);
+ADDSYMBOL(search);
+ADDSYMBOL(seconds);
+ADDSYMBOL(seed);
+ADDSYMBOL(seek);
+ADDSYMBOL(seekeof);
+ADDSYMBOL(separator);
+ADDSYMBOL(sequence);
+ADDSYMBOL(sgn);
+ADDSYMBOL(shader);
+ADDSYMBOL(shift);
+ADDSYMBOL(shiftless);
+ADDSYMBOL(shininess);
+ADDSYMBOL(shipout);
+ADDSYMBOL(shipout3);
+ADDSYMBOL(side);
+ADDSYMBOL(sign);
+ADDSYMBOL(signedint);
+ADDSYMBOL(simplify);
+ADDSYMBOL(simpson);
+ADDSYMBOL(sin);
+ADDSYMBOL(singleint);
+ADDSYMBOL(singlereal);
+ADDSYMBOL(sinh);
+ADDSYMBOL(size);
+ADDSYMBOL(size3);
+ADDSYMBOL(slant);
+ADDSYMBOL(sleep);
+ADDSYMBOL(solve);
+ADDSYMBOL(sort);
+ADDSYMBOL(spec);
+ADDSYMBOL(specular);
+ADDSYMBOL(sqrt);
+ADDSYMBOL(srand);
+ADDSYMBOL(src);
+ADDSYMBOL(start);
+ADDSYMBOL(stop);
+ADDSYMBOL(store);
+ADDSYMBOL(straight);
+ADDSYMBOL(straightness);
+ADDSYMBOL(string);
+ADDSYMBOL(stringcolumn);
+ADDSYMBOL(stripdirectory);
+ADDSYMBOL(stripextension);
+ADDSYMBOL(stripfile);
+ADDSYMBOL(stroke);
+ADDSYMBOL(subpath);
+ADDSYMBOL(substr);
+ADDSYMBOL(suffix);
+ADDSYMBOL(sum);
+ADDSYMBOL(system);
+ADDSYMBOL(t);
+ADDSYMBOL(tabcompletion);
+ADDSYMBOL(tan);
+ADDSYMBOL(tanh);
+ADDSYMBOL(target);
+ADDSYMBOL(tell);
+ADDSYMBOL(tensionSpecifier);
+ADDSYMBOL(tensorshade);
+ADDSYMBOL(tessellate);
+ADDSYMBOL(tex);
+ADDSYMBOL(texpreamble);
+ADDSYMBOL(texreset);
+ADDSYMBOL(texsize);
+ADDSYMBOL(textpath);
+ADDSYMBOL(theta);
+ADDSYMBOL(time);
+ADDSYMBOL(tin);
+ADDSYMBOL(to);
+ADDSYMBOL(tok);
+ADDSYMBOL(tolerance);
+ADDSYMBOL(tout);
+ADDSYMBOL(transform);
+ADDSYMBOL(translate);
+ADDSYMBOL(transpose);
+ADDSYMBOL(triangulate);
+ADDSYMBOL(tridiagonal);
+ADDSYMBOL(type);
+ADDSYMBOL(u);
+ADDSYMBOL(uknot);
+ADDSYMBOL(unique);
+ADDSYMBOL(unit);
+ADDSYMBOL(unitrand);
+ADDSYMBOL(unstraighten);
+ADDSYMBOL(upcase);
+ADDSYMBOL(update);
+ADDSYMBOL(uptodate);
+ADDSYMBOL(usleep);
+ADDSYMBOL(v);
+ADDSYMBOL(value);
+ADDSYMBOL(verbose);
+ADDSYMBOL(vi);
+ADDSYMBOL(view);
+ADDSYMBOL(viewportlighting);
+ADDSYMBOL(vknot);
+ADDSYMBOL(w);
+ADDSYMBOL(w0);
+ADDSYMBOL(w1);
+ADDSYMBOL(w2);
+ADDSYMBOL(w3);
+ADDSYMBOL(wait);
+ADDSYMBOL(walltime);
+ADDSYMBOL(warn);
+ADDSYMBOL(warning);
+ADDSYMBOL(weights);
+ADDSYMBOL(width);
+ADDSYMBOL(windingnumber);
+ADDSYMBOL(word);
+ADDSYMBOL(write);
+ADDSYMBOL(writerows);
+ADDSYMBOL(x);
+ADDSYMBOL(x1);
+ADDSYMBOL(x2);
+ADDSYMBOL(xform);
+ADDSYMBOL(xpart);
+ADDSYMBOL(xscale);
+ADDSYMBOL(xx);
+ADDSYMBOL(xy);
+ADDSYMBOL(y);
+ADDSYMBOL(ypart);
+ADDSYMBOL(yscale);
+ADDSYMBOL(yx);
+ADDSYMBOL(yy);
+ADDSYMBOL(z);
+ADDSYMBOL(z0);
+ADDSYMBOL(z1);
+ADDSYMBOL(z2);
+ADDSYMBOL(z3);
+ADDSYMBOL(zin);
+ADDSYMBOL(zoom);
+ADDSYMBOL(zout);
+ADDSYMBOL(zpart);
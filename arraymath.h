@@ -0,0 +1,360 @@
+/*****
+ * arraymath.h
+ *
+ * Element-wise arithmetic, comparisons, and math functions over arrays of
+ * reals, pairs, and triples, evaluated natively on contiguous buffers.
+ *****/
+#ifndef ARRAYMATH_H
+#define ARRAYMATH_H
+
+#include <algorithm>
+#include <vector>
+
+#include "common.h"
+#include "util.h"
+#include "array.h"
+#include "mathop.h"
+
+namespace run {
+
+using vm::array;
+using vm::read;
+
+// The smallest number of elements worth handing to a thread: arithmetic is
+// limited by memory bandwidth, whereas math functions are not.
+const size_t vecgrain=65536;
+const size_t vecfuncgrain=8192;
+
+// The number of elements copied into native buffers at a time.
+const size_t vecblock=1024;
+
+// Compile the kernels for AVX2 as well, choosing the version to run from the
+// processor when the program is loaded.
+#if defined(__GNUC__) && !defined(__clang__) && __GNUC__ >= 6 && \
+  defined(__x86_64__) && defined(__linux__)
+#define VECCLONES __attribute__((target_clones("avx2","default")))
+#else
+#define VECCLONES
+#endif
+
+// Types whose values are copied out of arrays into native buffers by
+// element-wise functions.
+template<class T>
+struct vecvalue {
+  static const bool native=false;
+};
+
+template<>
+struct vecvalue<double> {
+  static const bool native=true;
+};
+
+template<>
+struct vecvalue<camp::pair> {
+  static const bool native=true;
+};
+
+template<>
+struct vecvalue<camp::triple> {
+  static const bool native=true;
+};
+
+// Results are computed into native buffers; bool is stored as char so that
+// the kernels vectorize. Only results that are not allocated when stored in
+// an array may be stored by threads other than the interpreter's; pairs and
+// triples are always evaluated item by item.
+template<class R>
+struct vecresult {
+  typedef R type;
+  static const bool shared=false;
+};
+
+template<>
+struct vecresult<double> {
+  typedef double type;
+  static const bool shared=true;
+};
+
+template<>
+struct vecresult<bool> {
+  typedef char type;
+  static const bool shared=true;
+};
+
+// An operation that cannot fail.
+template<class R>
+struct vecpure {
+  static const bool native=true;
+  typedef R result;
+  template<class T>
+  static bool valid(const T&) {return true;}
+};
+
+// An operation that fails only for a zero right operand.
+template<class R>
+struct vecdivide {
+  static const bool native=true;
+  typedef R result;
+  template<class T>
+  static bool valid(const T& y) {return !(y == 0);}
+};
+
+// Which operations op<T> may be applied to native values of T, and the type
+// of their results. The kernels run off the interpreter thread, so an
+// operation may be listed here only if it never calls error or
+// integeroverflow; any argument that it would reject must instead be caught
+// beforehand by the valid check of its kind.
+template<class T, template <class S> class op>
+struct vecop {
+  static const bool native=false;
+};
+
+#define VECOP(T,op,kind,R)                                      \
+  template<> struct vecop<T,op> : public kind<R> {};
+
+VECOP(double,plus,vecpure,double)
+VECOP(double,minus,vecpure,double)
+VECOP(double,times,vecpure,double)
+VECOP(double,divide,vecdivide,double)
+VECOP(double,mod,vecdivide,double)
+VECOP(double,power,vecpure,double)
+VECOP(double,min,vecpure,double)
+VECOP(double,max,vecpure,double)
+VECOP(double,less,vecpure,bool)
+VECOP(double,lessequals,vecpure,bool)
+VECOP(double,equals,vecpure,bool)
+VECOP(double,greaterequals,vecpure,bool)
+VECOP(double,greater,vecpure,bool)
+VECOP(double,notequals,vecpure,bool)
+
+VECOP(camp::pair,equals,vecpure,bool)
+VECOP(camp::pair,notequals,vecpure,bool)
+
+VECOP(camp::triple,equals,vecpure,bool)
+VECOP(camp::triple,notequals,vecpure,bool)
+
+#undef VECOP
+
+// The kernel: set c[k]=f(k) for k=0,...,n-1.
+template<class R, class F>
+VECCLONES
+void vecApply(R *c, size_t n, const F& f)
+{
+  for(size_t k=0; k < n; ++k)
+    c[k]=f(k);
+}
+
+// Evaluate f for the elements [begin,end) of the preallocated array c, a
+// block at a time: f.load(i,k) copies the operands of element i into slot k
+// of its buffers and f(k) computes the result from slot k. Nothing is
+// reported here, as this may run off the interpreter thread; false is
+// returned instead if an element is uninitialized or f.load rejects it.
+template<class F>
+bool vecRange(F& f, array *c, size_t begin, size_t end)
+{
+  typedef typename F::result R;
+  typename vecresult<R>::type v[vecblock];
+  try {
+    for(size_t i=begin; i < end; i += vecblock) {
+      size_t m=std::min(vecblock,end-i);
+      for(size_t k=0; k < m; ++k)
+        if(!f.load(i+k,k)) return false;
+      vecApply(v,m,f);
+      for(size_t k=0; k < m; ++k)
+        (*c)[i+k]=(R) v[k];
+    }
+  } catch(vm::bad_item_value&) {
+    return false;
+  }
+  return true;
+}
+
+template<class F>
+struct vecjob {
+  const F *f;
+  array *c;
+  size_t n;
+  size_t threads;
+  std::vector<char> ok;
+
+  static void chunk(void *job, size_t i) {
+    vecjob *J=(vecjob *) job;
+    F f(*J->f);
+    J->ok[i]=vecRange(f,J->c,J->n*i/J->threads,J->n*(i+1)/J->threads);
+  }
+};
+
+// Evaluate f for all n elements of the preallocated array c on several
+// threads. On a single thread, copying the items to and from the buffers
+// costs as much as evaluating them one by one, so false is returned without
+// evaluating anything when n is too small to share out. False is also
+// returned if some element could not be evaluated. Either way, the caller
+// then evaluates the elements item by item, reporting any error.
+template<class F>
+bool vecEvaluate(const F& f, array *c, size_t n, size_t grain)
+{
+  typedef typename F::result R;
+  if(!vecresult<R>::shared) return false;
+  vecjob<F> job;
+  job.f=&f;
+  job.c=c;
+  job.n=n;
+  job.threads=threadcount(n,grain);
+  if(job.threads <= 1) return false;
+  job.ok.resize(job.threads);
+  parallel(job.threads,vecjob<F>::chunk,&job);
+  for(size_t i=0; i < job.threads; ++i)
+    if(!job.ok[i]) return false;
+  return true;
+}
+
+template<class T, class U, template <class S> class op>
+struct vecArrayOp {
+  typedef vecop<T,op> check;
+  typedef typename check::result result;
+  array *a;
+  U b;
+  T va[vecblock];
+
+  vecArrayOp(array *a, U b) : a(a), b(b) {}
+  bool load(size_t i, size_t k) {
+    va[k]=read<T>(a,i);
+    return check::valid(b);
+  }
+  result operator()(size_t k) const {return op<T>()(va[k],b);}
+};
+
+template<class T, class U, template <class S> class op>
+struct vecOpArray {
+  typedef vecop<U,op> check;
+  typedef typename check::result result;
+  T b;
+  array *a;
+  U va[vecblock];
+
+  vecOpArray(T b, array *a) : b(b), a(a) {}
+  bool load(size_t i, size_t k) {
+    va[k]=read<U>(a,i);
+    return check::valid(va[k]);
+  }
+  result operator()(size_t k) const {return op<U>()(b,va[k]);}
+};
+
+template<class T, template <class S> class op>
+struct vecArrayArray {
+  typedef vecop<T,op> check;
+  typedef typename check::result result;
+  array *a;
+  array *b;
+  T va[vecblock];
+  T vb[vecblock];
+
+  vecArrayArray(array *a, array *b) : a(a), b(b) {}
+  bool load(size_t i, size_t k) {
+    va[k]=read<T>(a,i);
+    vb[k]=read<T>(b,i);
+    return check::valid(vb[k]);
+  }
+  result operator()(size_t k) const {return op<T>()(va[k],vb[k]);}
+};
+
+template<class T, class S, T (*func)(S)>
+struct vecFunc {
+  typedef T result;
+  array *a;
+  S va[vecblock];
+
+  vecFunc(array *a) : a(a) {}
+  bool load(size_t i, size_t k) {
+    va[k]=read<S>(a,i);
+    return true;
+  }
+  result operator()(size_t k) const {return func(va[k]);}
+};
+
+// Read element i of a, reporting the element k if it is uninitialized.
+template<class T>
+inline T readelement(array *a, size_t i, size_t k)
+{
+  try {
+    return read<T>(a,i);
+  } catch(vm::bad_item_value&) {
+    uninitialized(k);
+    return T();
+  }
+}
+
+// Fill the preallocated array c of size n with op applied element by element
+// to arrays of T, item by item unless op<T> may be evaluated natively. When
+// index is set, errors report the offending element.
+template<class T, template <class S> class op,
+         bool native=vecop<T,op>::native>
+struct elementwise {
+  template<class U>
+  static void arrayOp(array *a, U b, array *c, size_t n, bool index) {
+    for(size_t i=0; i < n; i++) {
+      size_t k=index ? i : 0;
+      (*c)[i]=op<T>()(readelement<T>(a,i,k),b,k);
+    }
+  }
+
+  template<class U>
+  static void opArray(U b, array *a, array *c, size_t n, bool index) {
+    for(size_t i=0; i < n; i++) {
+      size_t k=index ? i : 0;
+      (*c)[i]=op<T>()(b,readelement<T>(a,i,k),k);
+    }
+  }
+
+  static void arrayArray(array *a, array *b, array *c, size_t n, bool index) {
+    for(size_t i=0; i < n; i++) {
+      size_t k=index ? i : 0;
+      (*c)[i]=op<T>()(readelement<T>(a,i,k),readelement<T>(b,i,k),k);
+    }
+  }
+};
+
+template<class T, template <class S> class op>
+struct elementwise<T,op,true> {
+  typedef elementwise<T,op,false> items;
+
+  template<class U>
+  static void arrayOp(array *a, U b, array *c, size_t n, bool index) {
+    if(!vecEvaluate(vecArrayOp<T,U,op>(a,b),c,n,vecgrain))
+      items::arrayOp(a,b,c,n,index);
+  }
+
+  template<class U>
+  static void opArray(U b, array *a, array *c, size_t n, bool index) {
+    if(!vecEvaluate(vecOpArray<U,T,op>(b,a),c,n,vecgrain))
+      items::opArray(b,a,c,n,index);
+  }
+
+  static void arrayArray(array *a, array *b, array *c, size_t n, bool index) {
+    if(!vecEvaluate(vecArrayArray<T,op>(a,b),c,n,vecgrain))
+      items::arrayArray(a,b,c,n,index);
+  }
+};
+
+// Fill the preallocated array c of size n with func applied to each element
+// of a.
+template<class T, class S, T (*func)(S),
+         bool native=vecvalue<T>::native && vecvalue<S>::native>
+struct elementfunc {
+  static void apply(array *a, array *c, size_t n) {
+    for(size_t i=0; i < n; i++)
+      (*c)[i]=func(read<S>(a,i));
+  }
+};
+
+template<class T, class S, T (*func)(S)>
+struct elementfunc<T,S,func,true> {
+  static void apply(array *a, array *c, size_t n) {
+    if(!vecEvaluate(vecFunc<T,S,func>(a),c,n,vecfuncgrain))
+      elementfunc<T,S,func,false>::apply(a,c,n);
+  }
+};
+
+} // namespace run
+
+#endif
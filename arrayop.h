@@ -14,6 +14,8 @@
 #include "fileio.h"
 #include "callable.h"
 #include "mathop.h"
+#include "arraysort.h"
+#include "arraymath.h"
 
 namespace run {
 
@@ -32,8 +34,7 @@ void arrayOp(vm::stack *s)
   array *a=pop<array*>(s);
   size_t size=checkArray(a);
   array *c=new array(size);
-  for(size_t i=0; i < size; i++)
-    (*c)[i]=op<T>()(read<T>(a,i),b,i);
+  elementwise<T,op>::arrayOp(a,b,c,size,true);
   s->push(c);
 }
 
@@ -44,8 +45,7 @@ void opArray(vm::stack *s)
   T b=pop<T>(s);
   size_t size=checkArray(a);
   array *c=new array(size);
-  for(size_t i=0; i < size; i++)
-    (*c)[i]=op<U>()(b,read<U>(a,i),i);
+  elementwise<U,op>::opArray(b,a,c,size,true);
   s->push(c);
 }
 
@@ -56,8 +56,7 @@ void arrayArrayOp(vm::stack *s)
   array *a=pop<array*>(s);
   size_t size=checkArrays(a,b);
   array *c=new array(size);
-  for(size_t i=0; i < size; i++)
-    (*c)[i]=op<T>()(read<T>(a,i),read<T>(b,i),i);
+  elementwise<T,op>::arrayArray(a,b,c,size,true);
   s->push(c);
 }
 
@@ -149,8 +148,7 @@ void array2Op(vm::stack *s)
     size_t aisize=checkArray(ai);
     array *ci=new array(aisize);
     (*c)[i]=ci;
-    for(size_t j=0; j < aisize; j++)
-      (*ci)[j]=op<T>()(read<T>(ai,j),b,0);
+    elementwise<T,op>::arrayOp(ai,b,ci,aisize,false);
   }
   s->push(c);
 }
@@ -167,8 +165,7 @@ void opArray2(vm::stack *s)
     size_t aisize=checkArray(ai);
     array *ci=new array(aisize);
     (*c)[i]=ci;
-    for(size_t j=0; j < aisize; j++)
-      (*ci)[j]=op<U>()(read<U>(ai,j),b,0);
+    elementwise<U,op>::arrayOp(ai,b,ci,aisize,false);
   }
   s->push(c);
 }
@@ -186,8 +183,7 @@ void array2Array2Op(vm::stack *s)
     size_t aisize=checkArrays(ai,bi);
     array *ci=new array(aisize);
     (*c)[i]=ci;
-    for(size_t j=0; j < aisize; j++)
-      (*ci)[j]=op<T>()(read<T>(ai,j),read<T>(bi,j),0);
+    elementwise<T,op>::arrayArray(ai,bi,ci,aisize,false);
   }
   s->push(c);
 }
@@ -252,11 +248,71 @@ struct compare {
   }
 };
 
+// Values of an array as they are sorted and searched natively: numbers
+// are copied while strings are referenced in place.
+template<class T>
+struct sortvalue {
+  typedef T type;
+  static T get(const vm::item& I) {return vm::get<T>(I);}
+  static const T& value(const T& x) {return x;}
+};
+
+template<>
+struct sortvalue<string> {
+  typedef stringref type;
+  static stringref get(const vm::item& I) {return vm::get<string*>(I);}
+  static const string& value(const stringref& x) {return *x.s;}
+};
+
+template<class T>
+void arrayValues(array *a, std::vector<typename sortvalue<T>::type>& v)
+{
+  size_t size=checkArray(a);
+  v.resize(size);
+  for(size_t i=0; i < size; i++)
+    v[i]=sortvalue<T>::get((*a)[i]);
+}
+
 template<class T>
 void sortArray(vm::stack *s)
 {
-  array *c=copyArray(pop<array*>(s));
-  sort(c->begin(),c->end(),compare<T>());
+  std::vector<typename sortvalue<T>::type> v;
+  arrayValues<T>(pop<array*>(s),v);
+  sortValues(v);
+  size_t size=v.size();
+  array *c=new array(size);
+  for(size_t i=0; i < size; i++)
+    (*c)[i]=sortvalue<T>::value(v[i]);
+  s->push(c);
+}
+
+// Return the indices that sort a stably.
+template<class T>
+void argsortArray(vm::stack *s)
+{
+  std::vector<typename sortvalue<T>::type> v;
+  arrayValues<T>(pop<array*>(s),v);
+  std::vector<Int> index;
+  sortIndices(v,index);
+  size_t size=index.size();
+  array *c=new array(size);
+  for(size_t i=0; i < size; i++)
+    (*c)[i]=index[i];
+  s->push(c);
+}
+
+// Return the distinct values of a in increasing order.
+template<class T>
+void uniqueArray(vm::stack *s)
+{
+  std::vector<typename sortvalue<T>::type> v;
+  arrayValues<T>(pop<array*>(s),v);
+  sortValues(v);
+  v.erase(std::unique(v.begin(),v.end()),v.end());
+  size_t size=v.size();
+  array *c=new array(size);
+  for(size_t i=0; i < size; i++)
+    (*c)[i]=sortvalue<T>::value(v[i]);
   s->push(c);
 }
 
@@ -279,11 +335,55 @@ struct compare2 {
 
 // Sort the rows of a 2-dimensional array by the first column, breaking
 // ties with successively higher columns.
+template<class T>
+struct rowsorter {
+  array *a;
+  rowsorter(array *a) : a(a) {}
+  
+  void chunk(Int *begin, Int *end, Int *) {
+    std::stable_sort(begin,end,*this);
+  }
+  
+  bool operator() (Int i, Int j) const {
+    return compare2<T>()((*a)[i],(*a)[j]);
+  }
+};
+
+// Can the rows of a be compared by threads, which cannot report errors?
+template<class T>
+bool initializedRows(array *a)
+{
+  size_t size=checkArray(a);
+  for(size_t i=0; i < size; i++) {
+    vm::item& I=(*a)[i];
+    if(I.empty()) return false;
+    array *ai=vm::get<array*>(I);
+    size_t aisize=checkArray(ai);
+    for(size_t j=0; j < aisize; j++)
+      if((*ai)[j].empty()) return false;
+  }
+  return true;
+}
+
 template<class T>
 void sortArray2(vm::stack *s)
 {
-  array *c=copyArray(pop<array*>(s));
-  stable_sort(c->begin(),c->end(),compare2<T>());
+  array *a=pop<array*>(s);
+  if(!initializedRows<T>(a)) {
+    array *c=copyArray(a);
+    stable_sort(c->begin(),c->end(),compare2<T>());
+    s->push(c);
+    return;
+  }
+  size_t size=checkArray(a);
+  std::vector<Int> index(size);
+  for(size_t i=0; i < size; i++)
+    index[i]=i;
+  rowsorter<T> sorter(a);
+  parallelSort(index,sorter);
+  array *c=new array(size);
+  for(size_t i=0; i < size; i++)
+    (*c)[i]=(*a)[index[i]];
   s->push(c);
 }
 
@@ -310,6 +410,47 @@ void searchArray(vm::stack *s)
   s->push(0);
 }
 
+template<class T>
+struct searchjob {
+  const std::vector<typename sortvalue<T>::type> *values;
+  const std::vector<typename sortvalue<T>::type> *keys;
+  std::vector<Int> *index;
+  size_t chunks;
+  
+  static void search(void *job, size_t k) {
+    searchjob *J=(searchjob *) job;
+    const std::vector<typename sortvalue<T>::type>& values=*J->values;
+    size_t n=J->keys->size();
+    for(size_t i=n*k/J->chunks; i < n*(k+1)/J->chunks; ++i)
+      (*J->index)[i]=std::upper_bound(values.begin(),values.end(),
+                                      (*J->keys)[i])-values.begin()-1;
+  }
+};
+
+// Search the sorted ordered array a for each element of key, as searchArray
+// does.
+template<class T>
+void searchArrays(vm::stack *s)
+{
+  array *key=pop<array*>(s);
+  array *a=pop<array*>(s);
+  std::vector<typename sortvalue<T>::type> values,keys;
+  arrayValues<T>(a,values);
+  arrayValues<T>(key,keys);
+  size_t size=keys.size();
+  std::vector<Int> index(size);
+  searchjob<T> job;
+  job.values=&values;
+  job.keys=&keys;
+  job.index=&index;
+  job.chunks=threadcount(size,sortgrain);
+  parallel(job.chunks,searchjob<T>::search,&job);
+  array *c=new array(size);
+  for(size_t i=0; i < size; i++)
+    (*c)[i]=index[i];
+  s->push(c);
+}
+
 extern string emptystring;
   
 void writestring(vm::stack *s);
@@ -403,36 +544,89 @@ void writeArray(vm::stack *s)
   f->flush();
 }
   
+// Only arrays of numbers are formatted in blocks.
 template<class T>
-void writeArray2(vm::stack *s)
-{
-  array *a=pop<array*>(s);
-  camp::file *f=pop<camp::file*>(s,&camp::Stdout);
-  
-  size_t size=checkArray(a);
-  if(f->Standard()) interact::lines=0;
-  else if(!f->isOpen()) return;
-  
-  try {
+struct numberwriter {
+  static bool writeRows(camp::file *, array *, const string&, bool) {
+    return false;
+  }
+};
+
+template<class T>
+struct numberrows {
+  // Write the rows of a to a text output file in blocks, returning false
+  // if f is some other kind of file.
+  static bool writeRows(camp::file *f, array *a, const string& separator,
+                        bool async) {
+    camp::ofile *o=dynamic_cast<camp::ofile *>(f);
+    if(!o || !o->text() || !o->Stream()) return false;
+    camp::blockwriter w(o->Stream(),async);
+    size_t size=checkArray(a);
     for(size_t i=0; i < size; i++) {
       vm::item& I=(*a)[i];
       if(!I.empty()) {
         array *ai=vm::get<array*>(I);
         size_t aisize=checkArray(ai);
         for(size_t j=0; j < aisize; j++) {
-          if(j > 0 && f->text()) f->write(tab);
+          if(j > 0) w.write(separator);
           vm::item& I=(*ai)[j];
           if(!I.empty())
-            f->write(vm::get<T>(I));
+            w.write(vm::get<T>(I));
         }
       }
-      if(f->text()) f->writeline();
+      w.write(camp::newline);
+      if(errorstream::interrupt) throw interrupted();
+    }
+    return true;
+  }
+};
+
+template<>
+struct numberwriter<Int> : public numberrows<Int> {};
+
+template<>
+struct numberwriter<double> : public numberrows<double> {};
+
+// Write the rows of a to f, separating the values in each row of a text
+// file with separator.
+template<class T>
+void writeRows(camp::file *f, array *a, const string& separator,
+               bool async=false)
+{
+  size_t size=checkArray(a);
+  if(f->Standard()) interact::lines=0;
+  else if(!f->isOpen()) return;
+  
+  try {
+    if(f->Standard() || !numberwriter<T>::writeRows(f,a,separator,async)) {
+      for(size_t i=0; i < size; i++) {
+        vm::item& I=(*a)[i];
+        if(!I.empty()) {
+          array *ai=vm::get<array*>(I);
+          size_t aisize=checkArray(ai);
+          for(size_t j=0; j < aisize; j++) {
+            if(j > 0 && f->text()) f->write(separator);
+            vm::item& I=(*ai)[j];
+            if(!I.empty())
+              f->write(vm::get<T>(I));
+          }
+        }
+        if(f->text()) f->writeline();
+      }
     }
   } catch (quit&) {
   }
   f->flush();
 }
 
+template<class T>
+void writeArray2(vm::stack *s)
+{
+  array *a=pop<array*>(s);
+  camp::file *f=pop<camp::file*>(s,&camp::Stdout);
+  writeRows<T>(f,a,tab);
+}
+
 template<class T>
 void writeArray3(vm::stack *s)
 {
@@ -478,8 +672,7 @@ void arrayFunc(vm::stack *s)
   array *a=pop<array*>(s);
   size_t size=checkArray(a);
   array *c=new array(size);
-  for(size_t i=0; i < size; i++)
-    (*c)[i]=func(read<S>(a,i));
+  elementfunc<T,S,func>::apply(a,c,size);
   s->push(c);
 }
 
@@ -494,8 +687,7 @@ void arrayFunc2(vm::stack *s)
     size_t aisize=checkArray(ai);
     array *ci=new array(aisize);
     (*c)[i]=ci;
-    for(size_t j=0; j < aisize; j++)
-    (*ci)[j]=func(read<S>(ai,j));
+    elementfunc<T,S,func>::apply(ai,ci,aisize);
   }
   s->push(c);
 }
@@ -0,0 +1,257 @@
+/*****
+ * arraysort.h
+ *
+ * Stable parallel sorting of native values, used by the array sort and
+ * search builtins.
+ *****/
+#ifndef ARRAYSORT_H
+#define ARRAYSORT_H
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+#include <stdint.h>
+
+#include "common.h"
+#include "util.h"
+
+namespace run {
+
+// The smallest number of values worth sorting or searching on a thread.
+const size_t sortgrain=65536;
+
+// Map reals to unsigned integers with the same order, placing -0.0 before
+// 0.0 and nan after all other reals.
+inline uint64_t sortkey(double x)
+{
+  if(x != x) return ~(uint64_t) 0;
+  uint64_t u;
+  memcpy(&u,&x,sizeof(u));
+  return (u >> 63) ? ~u : u | ((uint64_t) 1 << 63);
+}
+
+inline uint64_t sortkey(Int x)
+{
+  return (uint64_t) x ^ ((uint64_t) 1 << 63);
+}
+
+// A reference to a string owned by an array, ordered by its value, which
+// lets strings be sorted without copying them.
+struct stringref {
+  const string *s;
+  stringref() : s(NULL) {}
+  stringref(const string *s) : s(s) {}
+  bool operator < (const stringref& b) const {return *s < *b.s;}
+  bool operator == (const stringref& b) const {return *s == *b.s;}
+};
+
+// A value together with its index in the original array.
+template<class T>
+struct ranked {
+  T value;
+  Int index;
+};
+
+template<class T>
+inline uint64_t sortkey(const ranked<T>& x)
+{
+  return sortkey(x.value);
+}
+
+// Sort the n values v stably by their sort keys with a least-significant
+// digit radix sort on 11-bit digits, using buf as scratch space.
+template<class E>
+void radixSort(E *v, E *buf, size_t n)
+{
+  const size_t bits=11;
+  const size_t radix=1 << bits;
+  const size_t digits=(64+bits-1)/bits;
+  const uint64_t mask=radix-1;
+  std::vector<size_t> count(digits*radix);
+  for(size_t i=0; i < n; ++i) {
+    uint64_t k=sortkey(v[i]);
+    for(size_t d=0; d < digits; ++d)
+      ++count[radix*d+((k >> bits*d) & mask)];
+  }
+  E *src=v, *dst=buf;
+  for(size_t d=0; d < digits; ++d) {
+    size_t *c=&count[radix*d];
+    // Skip digits that are the same for every value.
+    if(c[(sortkey(src[0]) >> bits*d) & mask] == n) continue;
+    size_t offset=0;
+    for(size_t b=0; b < radix; ++b) {
+      size_t m=c[b];
+      c[b]=offset;
+      offset += m;
+    }
+    for(size_t i=0; i < n; ++i)
+      dst[c[(sortkey(src[i]) >> bits*d) & mask]++]=src[i];
+    std::swap(src,dst);
+  }
+  if(src != v) std::copy(src,src+n,v);
+}
+
+// Sort numbers by their sort keys.
+struct radixsorter {
+  template<class E>
+  void chunk(E *begin, E *end, E *buf) {
+    if(begin < end) radixSort(begin,buf,end-begin);
+  }
+
+  template<class E>
+  bool operator() (const E& a, const E& b) const {
+    return sortkey(a) < sortkey(b);
+  }
+};
+
+// Sort indices of the values of a vector.
+template<class T>
+struct indexsorter {
+  const std::vector<T>& values;
+  indexsorter(const std::vector<T>& values) : values(values) {}
+
+  template<class E>
+  void chunk(E *begin, E *end, E *) {
+    std::stable_sort(begin,end,*this);
+  }
+
+  bool operator() (size_t i, size_t j) const {
+    return values[i] < values[j];
+  }
+};
+
+template<class E, class Sorter>
+struct sortjob {
+  Sorter *sorter;
+  E *src,*dst;
+  std::vector<size_t> bounds;
+  size_t chunks;
+  size_t width;
+
+  static void sortChunk(void *job, size_t i) {
+    sortjob *J=(sortjob *) job;
+    size_t *b=&J->bounds[0];
+    J->sorter->chunk(J->src+b[i],J->src+b[i+1],J->dst+b[i]);
+  }
+
+  // Merge sorted runs of width chunks pairwise from src into dst.
+  static void mergeChunks(void *job, size_t i) {
+    sortjob *J=(sortjob *) job;
+    size_t *b=&J->bounds[0];
+    size_t lo=2*i*J->width;
+    size_t mid=std::min(lo+J->width,J->chunks);
+    size_t hi=std::min(mid+J->width,J->chunks);
+    std::merge(J->src+b[lo],J->src+b[mid],J->src+b[mid],J->src+b[hi],
+               J->dst+b[lo],*J->sorter);
+  }
+};
+
+// Sort v stably, sorting a chunk on each of the given number of threads
+// and then merging pairs of chunks in parallel. Sorter provides the order
+// and a method chunk(begin,end,buf) that sorts [begin,end), using buf as
+// scratch space.
+template<class E, class Sorter>
+void parallelSort(std::vector<E>& v, Sorter& sorter, size_t threads)
+{
+  size_t n=v.size();
+  if(n == 0) return;
+  std::vector<E> buf(n);
+  threads=std::max(std::min(threads,n),(size_t) 1);
+  if(threads == 1) {
+    sorter.chunk(&v[0],&v[0]+n,&buf[0]);
+    return;
+  }
+
+  sortjob<E,Sorter> job;
+  job.sorter=&sorter;
+  job.src=&v[0];
+  job.dst=&buf[0];
+  job.chunks=threads;
+  job.bounds.resize(threads+1);
+  for(size_t i=0; i <= threads; ++i)
+    job.bounds[i]=n*i/threads;
+
+  parallel(threads,sortjob<E,Sorter>::sortChunk,&job);
+  for(job.width=1; job.width < threads; job.width *= 2) {
+    parallel((threads+2*job.width-1)/(2*job.width),
+             sortjob<E,Sorter>::mergeChunks,&job);
+    std::swap(job.src,job.dst);
+  }
+  if(job.src != &v[0]) std::copy(job.src,job.src+n,&v[0]);
+}
+
+template<class E, class Sorter>
+void parallelSort(std::vector<E>& v, Sorter& sorter)
+{
+  parallelSort(v,sorter,threadcount(v.size(),sortgrain));
+}
+
+// Sort the values of v.
+template<class T>
+void sortValues(std::vector<T>& v)
+{
+  size_t n=v.size();
+  std::vector<Int> index(n);
+  for(size_t i=0; i < n; ++i)
+    index[i]=i;
+  indexsorter<T> sorter(v);
+  parallelSort(index,sorter);
+  std::vector<T> w(n);
+  for(size_t i=0; i < n; ++i)
+    w[i]=v[index[i]];
+  v.swap(w);
+}
+
+inline void sortValues(std::vector<double>& v)
+{
+  radixsorter sorter;
+  parallelSort(v,sorter);
+}
+
+inline void sortValues(std::vector<Int>& v)
+{
+  radixsorter sorter;
+  parallelSort(v,sorter);
+}
+
+// Set index to the permutation that sorts the values of v stably.
+template<class T>
+void sortIndices(const std::vector<T>& v, std::vector<Int>& index)
+{
+  size_t n=v.size();
+  index.resize(n);
+  for(size_t i=0; i < n; ++i)
+    index[i]=i;
+  indexsorter<T> sorter(v);
+  parallelSort(index,sorter);
+}
+
+template<class T>
+void sortNumberIndices(const std::vector<T>& v, std::vector<Int>& index)
+{
+  size_t n=v.size();
+  std::vector<ranked<T> > r(n);
+  for(size_t i=0; i < n; ++i) {
+    r[i].value=v[i];
+    r[i].index=i;
+  }
+  radixsorter sorter;
+  parallelSort(r,sorter);
+  index.resize(n);
+  for(size_t i=0; i < n; ++i)
+    index[i]=r[i].index;
+}
+
+inline void sortIndices(const std::vector<double>& v, std::vector<Int>& index)
+{
+  sortNumberIndices(v,index);
+}
+
+inline void sortIndices(const std::vector<Int>& v, std::vector<Int>& index)
+{
+  sortNumberIndices(v,index);
+}
+
+} // namespace run
+
+#endif
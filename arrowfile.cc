@@ -0,0 +1,529 @@
+/*****
+ * arrowfile.cc
+ *
+ * Read columns of Arrow IPC files (including Feather version 2 files).
+ *****/
+
+#include <cstring>
+#include <cmath>
+#include <limits>
+#include <stdint.h>
+
+#include "arrowfile.h"
+
+#ifdef HAVE_MMAP
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+namespace camp {
+
+// Arrow type identifiers.
+enum {NullType=1,IntType,FloatingPointType,BinaryType,Utf8Type,BoolType,
+      DecimalType,DateType,TimeType,TimestampType,IntervalType,ListType,
+      StructType,UnionType,FixedSizeBinaryType,FixedSizeListType,MapType,
+      DurationType,LargeBinaryType,LargeUtf8Type,LargeListType,
+      RunEndEncodedType,BinaryViewType,Utf8ViewType,ListViewType,
+      LargeListViewType};
+
+// Arrow message types.
+enum {SchemaMessage=1,DictionaryBatchMessage,RecordBatchMessage};
+
+// Read a little-endian value.
+template<class T>
+inline T get(const unsigned char *p)
+{
+  T x;
+#ifdef WORDS_BIGENDIAN
+  unsigned char b[sizeof(T)];
+  for(size_t i=0; i < sizeof(T); ++i)
+    b[i]=p[sizeof(T)-1-i];
+  memcpy(&x,b,sizeof(T));
+#else
+  memcpy(&x,p,sizeof(T));
+#endif
+  return x;
+}
+
+struct invalidfile {
+  string reason;
+  invalidfile(const string& reason) : reason(reason) {}
+};
+
+// Reads the tables, vectors, and strings of the flatbuffers that encode
+// Arrow metadata.
+class flatbuffer {
+  const unsigned char *data;
+  size_t size;
+public:
+  flatbuffer(const unsigned char *data, size_t size) :
+    data(data), size(size) {}
+
+  void check(size_t pos, size_t n) {
+    if(pos > size || n > size-pos)
+      throw invalidfile("metadata out of bounds");
+  }
+
+  template<class T>
+  T value(size_t pos) {
+    check(pos,sizeof(T));
+    return get<T>(data+pos);
+  }
+
+  // Follow the offset stored at pos.
+  size_t deref(size_t pos) {return pos+value<uint32_t>(pos);}
+
+  // Return the position of field i of table t, or 0 if it is absent.
+  size_t field(size_t t, size_t i) {
+    size_t vtable=t-(ptrdiff_t) value<int32_t>(t);
+    size_t vsize=value<uint16_t>(vtable);
+    if(4+2*i+2 > vsize) return 0;
+    size_t offset=value<uint16_t>(vtable+4+2*i);
+    return offset ? t+offset : 0;
+  }
+
+  template<class T>
+  T scalar(size_t t, size_t i, T x=T()) {
+    size_t p=field(t,i);
+    return p ? value<T>(p) : x;
+  }
+
+  size_t table(size_t t, size_t i) {
+    size_t p=field(t,i);
+    return p ? deref(p) : 0;
+  }
+
+  // Return the length of the vector in field i of table t, setting pos to
+  // the position of its first element.
+  size_t vector(size_t t, size_t i, size_t& pos) {
+    size_t v=table(t,i);
+    if(v == 0) {
+      pos=0;
+      return 0;
+    }
+    pos=v+4;
+    return value<uint32_t>(v);
+  }
+
+  string text(size_t t, size_t i) {
+    size_t v=table(t,i);
+    if(v == 0) return "";
+    size_t n=value<uint32_t>(v);
+    check(v+4,n);
+    return string((const char *) data+v+4,n);
+  }
+};
+
+void iarrowfile::invalid(const string& reason)
+{
+  ostringstream buf;
+  buf << name << ": " << reason;
+  reportError(buf);
+}
+
+void iarrowfile::open()
+{
+#ifdef HAVE_MMAP
+  int fd=::open(name.c_str(),O_RDONLY);
+  if(fd >= 0) {
+    struct stat buf;
+    if(fstat(fd,&buf) == 0 && buf.st_size > 0) {
+      mapping=mmap(NULL,buf.st_size,PROT_READ,MAP_PRIVATE,fd,0);
+      if(mapping != MAP_FAILED) {
+        data=(const unsigned char *) mapping;
+        size=buf.st_size;
+      } else mapping=NULL;
+    }
+    ::close(fd);
+  }
+#endif
+  if(!data) {
+    std::ifstream fin(name.c_str(),std::ios::binary);
+    if(fin) {
+      contents.assign(std::istreambuf_iterator<char>(fin),
+                      std::istreambuf_iterator<char>());
+      if(!contents.empty()) {
+        data=&contents[0];
+        size=contents.size();
+      }
+    }
+  }
+  if(check) Check();
+  if(data) {
+    try {
+      parse();
+    } catch(invalidfile& e) {
+      close();
+      invalid(e.reason);
+    }
+  }
+}
+
+void iarrowfile::close()
+{
+#ifdef HAVE_MMAP
+  if(mapping) {
+    munmap(mapping,size);
+    mapping=NULL;
+  }
+#endif
+  contents.clear();
+  if(data) closed=true;
+  data=NULL;
+  size=0;
+}
+
+// Read the messages of an IPC stream, which follows the magic number in an
+// IPC file.
+void iarrowfile::parse()
+{
+  static const char *magic="ARROW1";
+  flatbuffer fb(data,size);
+  size_t pos=0, end=size;
+  if(size >= 8 && memcmp(data,magic,6) == 0) {
+    pos=8;
+    if(size >= 18 && memcmp(data+size-6,magic,6) == 0) {
+      size_t footer=fb.value<uint32_t>(size-10);
+      if(footer <= size-18) end=size-10-footer;
+    }
+  }
+  while(pos < end && (pos=message(fb,pos,end)) != 0)
+    ;
+  if(nodecount == 0) throw invalidfile("missing schema");
+}
+
+// Read the message at pos, returning the position of the next message or
+// 0 at the end of the stream.
+size_t iarrowfile::message(flatbuffer& fb, size_t pos, size_t end)
+{
+  if(end-pos < 4) return 0;
+  size_t n=fb.value<uint32_t>(pos);
+  if(n == 0xFFFFFFFF) {
+    pos += 4;
+    n=fb.value<uint32_t>(pos);
+  }
+  pos += 4;
+  if(n == 0) return 0;
+  fb.check(pos,n);
+  size_t root=fb.deref(pos);
+  unsigned type=fb.scalar<uint8_t>(root,1);
+  size_t header=fb.table(root,2);
+  int64_t bodylength=fb.scalar<int64_t>(root,3);
+  size_t body=pos+n;
+  if(bodylength < 0) throw invalidfile("invalid message body");
+  fb.check(body,bodylength);
+  if(header) {
+    if(type == SchemaMessage) {
+      if(nodecount == 0) schema(fb,header);
+    } else if(type == RecordBatchMessage) {
+      if(nodecount == 0) throw invalidfile("record batch precedes schema");
+      recordbatch(fb,header,body,bodylength);
+    }
+  }
+  return body+bodylength;
+}
+
+void iarrowfile::schema(flatbuffer& fb, size_t t)
+{
+  if(fb.scalar<int16_t>(t,0) != 0)
+    throw invalidfile("big-endian data is not supported");
+  size_t pos;
+  size_t n=fb.vector(t,1,pos);
+  for(size_t k=0; k < n; ++k) {
+    size_t field=fb.deref(pos+4*k);
+    column c;
+    c.name=fb.text(field,0);
+    c.type=fb.scalar<uint8_t>(field,2);
+    c.dictionary=fb.table(field,4) != 0;
+    c.bitwidth=64;
+    c.issigned=true;
+    size_t type=fb.table(field,3);
+    switch(c.type) {
+      case IntType:
+        c.bitwidth=fb.scalar<int32_t>(type,0);
+        c.issigned=fb.scalar<uint8_t>(type,1);
+        break;
+      case FloatingPointType:
+        c.bitwidth=16 << fb.scalar<int16_t>(type,0);
+        break;
+      case BoolType:
+        c.bitwidth=1;
+        break;
+      case DateType:
+        c.bitwidth=fb.scalar<int16_t>(type,0,1) == 0 ? 32 : 64;
+        break;
+      case TimeType:
+        c.bitwidth=fb.scalar<int32_t>(type,1,32);
+        break;
+      case BinaryType:
+      case Utf8Type:
+        c.bitwidth=32;
+        break;
+    }
+    if(c.bitwidth != 1 && c.bitwidth != 8 && c.bitwidth != 16 &&
+       c.bitwidth != 32 && c.bitwidth != 64)
+      throw invalidfile("invalid bit width in column "+c.name);
+    c.located=located;
+    c.node=nodecount;
+    c.buffer=buffercount;
+    layout(fb,field);
+    columns.push_back(c);
+  }
+}
+
+// Count the field nodes and buffers used by a field and its children.
+void iarrowfile::layout(flatbuffer& fb, size_t field)
+{
+  ++nodecount;
+  if(fb.table(field,4)) {
+    // Only the dictionary indices appear in record batches.
+    buffercount += 2;
+    return;
+  }
+  switch(fb.scalar<uint8_t>(field,2)) {
+    case NullType:
+    case RunEndEncodedType:
+      break;
+    case FixedSizeListType:
+    case StructType:
+      buffercount += 1;
+      break;
+    case UnionType:
+      buffercount += fb.scalar<int16_t>(fb.table(field,3),0) == 1 ? 2 : 1;
+      break;
+    case IntType:
+    case FloatingPointType:
+    case BoolType:
+    case DecimalType:
+    case DateType:
+    case TimeType:
+    case TimestampType:
+    case IntervalType:
+    case FixedSizeBinaryType:
+    case DurationType:
+    case ListType:
+    case MapType:
+    case LargeListType:
+      buffercount += 2;
+      break;
+    case BinaryType:
+    case Utf8Type:
+    case LargeBinaryType:
+    case LargeUtf8Type:
+    case ListViewType:
+    case LargeListViewType:
+      buffercount += 3;
+      break;
+    default:
+      located=false;
+  }
+  size_t pos;
+  size_t n=fb.vector(field,5,pos);
+  for(size_t k=0; k < n; ++k)
+    layout(fb,fb.deref(pos+4*k));
+}
+
+void iarrowfile::recordbatch(flatbuffer& fb, size_t t, size_t body,
+                             size_t bodylength)
+{
+  if(fb.table(t,3))
+    throw invalidfile("compressed record batches are not supported");
+  batch b;
+  int64_t length=fb.scalar<int64_t>(t,0);
+  if(length < 0) throw invalidfile("invalid record batch length");
+  b.length=length;
+  b.nodecount=fb.vector(t,1,b.nodes);
+  b.buffercount=fb.vector(t,2,b.buffers);
+  fb.check(b.nodes,16*b.nodecount);
+  fb.check(b.buffers,16*b.buffercount);
+  if(located && (b.nodecount != nodecount || b.buffercount != buffercount))
+    throw invalidfile("record batch does not match schema");
+  b.body=body;
+  b.bodylength=bodylength;
+  batches.push_back(b);
+  rows += b.length;
+}
+
+const iarrowfile::column& iarrowfile::find(const string& name)
+{
+  for(size_t i=0; i < columns.size(); ++i)
+    if(columns[i].name == name) return columns[i];
+  invalid("no column named '"+name+"'");
+  return columns[0];
+}
+
+void iarrowfile::buffers(const batch& b, const column& c,
+                         const unsigned char *buf[3], size_t length[3])
+{
+  if(c.node >= b.nodecount) invalid("missing field node");
+  if(get<int64_t>(data+b.nodes+16*c.node) != b.length)
+    invalid("column "+c.name+" has the wrong length");
+  int64_t nulls=get<int64_t>(data+b.nodes+16*c.node+8);
+  size_t n=c.type == BinaryType || c.type == Utf8Type ||
+    c.type == LargeBinaryType || c.type == LargeUtf8Type ? 3 : 2;
+  if(c.buffer+n > b.buffercount) invalid("missing buffer");
+  size_t rows=b.length;
+  size_t minimum[3]={nulls > 0 ? (rows+7)/8 : 0,
+                     n == 3 ? (rows+1)*c.bitwidth/8 : (rows*c.bitwidth+7)/8,
+                     0};
+  for(size_t i=0; i < n; ++i) {
+    const unsigned char *p=data+b.buffers+16*(c.buffer+i);
+    int64_t offset=get<int64_t>(p);
+    int64_t size=get<int64_t>(p+8);
+    if(offset < 0 || size < 0 || (size_t) offset > b.bodylength ||
+       (size_t) size > b.bodylength-offset || (size_t) size < minimum[i])
+      invalid("invalid buffer in column "+c.name);
+    buf[i]=data+b.body+offset;
+    length[i]=size;
+  }
+  if(nulls == 0) buf[0]=NULL;
+}
+
+double iarrowfile::real(const column& c, const unsigned char *buf[3],
+                        size_t *, size_t i)
+{
+  const unsigned char *p=buf[1];
+  if(c.type == FloatingPointType) {
+    switch(c.bitwidth) {
+      case 16: {
+        unsigned h=get<uint16_t>(p+2*i);
+        int e=(h >> 10) & 0x1f;
+        double m=h & 0x3ff;
+        double x=e == 0 ? ldexp(m,-24) : e == 31 ?
+          (m == 0 ? std::numeric_limits<double>::infinity() :
+           std::numeric_limits<double>::quiet_NaN()) : ldexp(m+1024,e-25);
+        return (h & 0x8000) ? -x : x;
+      }
+      case 32: return get<float>(p+4*i);
+      default: return get<double>(p+8*i);
+    }
+  }
+  if(c.bitwidth == 64 && !c.issigned) return get<uint64_t>(p+8*i);
+  return integer(c,buf,NULL,i);
+}
+
+Int iarrowfile::integer(const column& c, const unsigned char *buf[3],
+                        size_t *, size_t i)
+{
+  const unsigned char *p=buf[1];
+  if(c.issigned) {
+    switch(c.bitwidth) {
+      case 1: return (p[i/8] >> (i%8)) & 1;
+      case 8: return get<int8_t>(p+i);
+      case 16: return get<int16_t>(p+2*i);
+      case 32: return get<int32_t>(p+4*i);
+      default: return get<int64_t>(p+8*i);
+    }
+  }
+  switch(c.bitwidth) {
+    case 8: return get<uint8_t>(p+i);
+    case 16: return get<uint16_t>(p+2*i);
+    case 32: return get<uint32_t>(p+4*i);
+    default: return Intcast(get<uint64_t>(p+8*i));
+  }
+}
+
+string iarrowfile::text(const column& c, const unsigned char *buf[3],
+                        size_t length[3], size_t i)
+{
+  int64_t first,last;
+  if(c.type == LargeBinaryType || c.type == LargeUtf8Type) {
+    first=get<int64_t>(buf[1]+8*i);
+    last=get<int64_t>(buf[1]+8*i+8);
+  } else {
+    first=get<int32_t>(buf[1]+4*i);
+    last=get<int32_t>(buf[1]+4*i+4);
+  }
+  if(first < 0 || last < first || (size_t) last > length[2])
+    invalid("invalid string offset in column "+c.name);
+  return string((const char *) buf[2]+first,last-first);
+}
+
+template<class T>
+vm::array *iarrowfile::read(const string& name, Int start, Int n, T null,
+                            T (iarrowfile::*value)(const column&,
+                                                   const unsigned char *[3],
+                                                   size_t [3], size_t))
+{
+  const column& c=find(name);
+  if(start < 0 || start > rows) {
+    ostringstream buf;
+    buf << "row " << start << " out of range";
+    invalid(buf.str());
+  }
+  if(n < 0 || n > rows-start) n=rows-start;
+  vm::array *a=new vm::array(n);
+  Int first=0, k=0;
+  for(size_t j=0; j < batches.size() && k < n; ++j) {
+    const batch& b=batches[j];
+    Int last=first+b.length;
+    if(last > start+k) {
+      const unsigned char *buf[3];
+      size_t length[3];
+      buffers(b,c,buf,length);
+      const unsigned char *valid=buf[0];
+      for(size_t i=start+k-first; k < n && (Int) i < b.length; ++i, ++k)
+        (*a)[k]=valid && !((valid[i/8] >> (i%8)) & 1) ? null :
+          (this->*value)(c,buf,length,i);
+    }
+    first=last;
+  }
+  return a;
+}
+
+vm::array *iarrowfile::names()
+{
+  size_t n=columns.size();
+  vm::array *a=new vm::array(n);
+  for(size_t i=0; i < n; ++i)
+    (*a)[i]=columns[i].name;
+  return a;
+}
+
+// Check that column c of type type can be read.
+static void readable(iarrowfile *f, bool ok, const string& name,
+                     const string& type)
+{
+  if(!ok) {
+    ostringstream buf;
+    buf << f->filename() << ": column " << name << " cannot be read as "
+        << type;
+    reportError(buf);
+  }
+}
+
+vm::array *iarrowfile::reals(const string& name, Int start, Int n)
+{
+  const column& c=find(name);
+  readable(this,c.located && !c.dictionary &&
+           (c.type == IntType || c.type == FloatingPointType ||
+            c.type == BoolType || c.type == DateType ||
+            c.type == TimeType || c.type == TimestampType ||
+            c.type == DurationType),name,"real");
+  return read(name,start,n,std::numeric_limits<double>::quiet_NaN(),
+              &iarrowfile::real);
+}
+
+vm::array *iarrowfile::integers(const string& name, Int start, Int n)
+{
+  const column& c=find(name);
+  readable(this,c.located && !c.dictionary &&
+           (c.type == IntType || c.type == BoolType || c.type == DateType ||
+            c.type == TimeType || c.type == TimestampType ||
+            c.type == DurationType),name,"int");
+  return read(name,start,n,(Int) 0,&iarrowfile::integer);
+}
+
+vm::array *iarrowfile::strings(const string& name, Int start, Int n)
+{
+  const column& c=find(name);
+  readable(this,c.located && !c.dictionary &&
+           (c.type == Utf8Type || c.type == BinaryType ||
+            c.type == LargeUtf8Type || c.type == LargeBinaryType),
+           name,"string");
+  return read(name,start,n,string(),&iarrowfile::text);
+}
+
+} // namespace camp
@@ -0,0 +1,107 @@
+/*****
+ * arrowfile.h
+ *
+ * Read columns of Arrow IPC files (including Feather version 2 files).
+ *****/
+
+#ifndef ARROWFILE_H
+#define ARROWFILE_H
+
+#include <vector>
+
+#include "fileio.h"
+#include "array.h"
+
+namespace camp {
+
+class flatbuffer;
+
+class iarrowfile : public file {
+  // A top-level field of the schema.
+  struct column {
+    string name;
+    unsigned type;      // Arrow type identifier
+    unsigned bitwidth;  // width of numbers; 64 for large strings
+    bool issigned;
+    bool dictionary;    // dictionary-encoded?
+    bool located;       // are the node and buffer indices known?
+    size_t node;        // index of the field node in each record batch
+    size_t buffer;      // index of the first buffer in each record batch
+  };
+
+  struct batch {
+    Int length;
+    size_t nodes;       // position of the field nodes
+    size_t nodecount;
+    size_t buffers;     // position of the buffer descriptions
+    size_t buffercount;
+    size_t body;        // position of the message body
+    size_t bodylength;
+  };
+
+  const unsigned char *data;
+  size_t size;
+  void *mapping;
+  std::vector<unsigned char> contents;
+
+  mem::vector<column> columns;
+  mem::vector<batch> batches;
+  size_t nodecount,buffercount;
+  bool located;
+  Int rows;
+
+  void invalid(const string& reason);
+
+  void parse();
+  size_t message(flatbuffer& fb, size_t pos, size_t end);
+  void schema(flatbuffer& fb, size_t table);
+  void layout(flatbuffer& fb, size_t field);
+  void recordbatch(flatbuffer& fb, size_t table, size_t body,
+                   size_t bodylength);
+
+  const column& find(const string& name);
+
+  // Return the buffers of column c in record batch b, after checking that
+  // they are large enough to hold the rows of the batch.
+  void buffers(const batch& b, const column& c, const unsigned char *buf[3],
+               size_t length[3]);
+
+  double real(const column& c, const unsigned char *buf[3],
+              size_t length[3], size_t i);
+  Int integer(const column& c, const unsigned char *buf[3],
+              size_t length[3], size_t i);
+  string text(const column& c, const unsigned char *buf[3],
+              size_t length[3], size_t i);
+
+  // Read rows [start,start+n) of the named column, using value to convert
+  // non-null entries and null for the others.
+  template<class T>
+  vm::array *read(const string& name, Int start, Int n, T null,
+                  T (iarrowfile::*value)(const column&,
+                                         const unsigned char *[3],
+                                         size_t [3], size_t));
+
+public:
+  iarrowfile(const string& name, bool check=true) :
+    file(name,check,AINPUT,true), data(NULL), size(0), mapping(NULL),
+    nodecount(0), buffercount(0), located(true), rows(0) {}
+
+  ~iarrowfile() {close();}
+
+  void open();
+  void close();
+
+  bool eof() {return true;}
+  bool error() {return data == NULL;}
+
+  Int length() {return rows;}
+
+  vm::array *names();
+  vm::array *reals(const string& name, Int start, Int n);
+  vm::array *integers(const string& name, Int start, Int n);
+  vm::array *strings(const string& name, Int start, Int n);
+};
+
+} // namespace camp
+
+#endif
@@ -420,6 +420,7 @@ struct Render
     glNormalPointer(GL_FLOAT,stride,&buffer[3]);
     if(c0) glColorPointer(4,GL_FLOAT,stride,&buffer[6]);
     glDrawElements(GL_TRIANGLES,indices.size(),GL_UNSIGNED_INT,&indices[0]);
+    gl::Ntriangles += indices.size()/3;
     if(c0) glDisableClientState(GL_COLOR_ARRAY);
     glDisableClientState(GL_VERTEX_ARRAY);
     glDisableClientState(GL_NORMAL_ARRAY);
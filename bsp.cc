@@ -0,0 +1,212 @@
+/*****
+ * bsp.cc
+ *
+ * Binary space partition of planar faces for hidden surface removal.
+ * This is a native implementation of the face splitting algorithm
+ * formerly in bsp.asy.
+ *****/
+
+#include <cfloat>
+#include <cmath>
+#include <algorithm>
+
+#include "bsp.h"
+#include "predicates.h"
+
+namespace camp {
+
+static const double epsilon=10.0*DBL_EPSILON;
+static const double factor=1.0/sqrt(DBL_EPSILON);
+
+static pair project(const triple& v, const double *T)
+{
+  double x=v.getx();
+  double y=v.gety();
+  double z=v.getz();
+  double f=T[12]*x+T[13]*y+T[14]*z+T[15];
+  if(f == 0.0) return pair(0.0,0.0);
+  f=1.0/f;
+  return pair((T[0]*x+T[1]*y+T[2]*z+T[3])*f,(T[4]*x+T[5]*y+T[6]*z+T[7])*f);
+}
+
+// Return any point on the intersection of the two planes with normals
+// n0 and n1 passing through points P0 and P1, respectively.
+static triple intersectionpoint(const triple& n0, const triple& P0,
+                                const triple& n1, const triple& P1)
+{
+  double Dx=n0.gety()*n1.getz()-n1.gety()*n0.getz();
+  double Dy=n0.getz()*n1.getx()-n1.getz()*n0.getx();
+  double Dz=n0.getx()*n1.gety()-n1.getx()*n0.gety();
+  if(fabs(Dx) > fabs(Dy) && fabs(Dx) > fabs(Dz)) {
+    Dx=1.0/Dx;
+    double d0=n0.gety()*P0.gety()+n0.getz()*P0.getz();
+    double d1=n1.gety()*P1.gety()+n1.getz()*P1.getz()+
+      n1.getx()*(P1.getx()-P0.getx());
+    double y=(d0*n1.getz()-d1*n0.getz())*Dx;
+    double z=(d1*n0.gety()-d0*n1.gety())*Dx;
+    return triple(P0.getx(),y,z);
+  } else if(fabs(Dy) > fabs(Dz)) {
+    Dy=1.0/Dy;
+    double d0=n0.getz()*P0.getz()+n0.getx()*P0.getx();
+    double d1=n1.getz()*P1.getz()+n1.getx()*P1.getx()+
+      n1.gety()*(P1.gety()-P0.gety());
+    double z=(d0*n1.getx()-d1*n0.getx())*Dy;
+    double x=(d1*n0.getz()-d0*n1.getz())*Dy;
+    return triple(x,P0.gety(),z);
+  } else {
+    Dz=1.0/Dz;
+    double d0=n0.getx()*P0.getx()+n0.gety()*P0.gety();
+    double d1=n1.getx()*P1.getx()+n1.gety()*P1.gety()+
+      n1.getz()*(P1.getz()-P0.getz());
+    double x=(d0*n1.gety()-d1*n0.gety())*Dz;
+    double y=(d1*n0.getx()-d0*n1.getx())*Dz;
+    return triple(x,y,P0.getz());
+  }
+}
+
+// Return the intersection point of the line through P in direction dir
+// with the line through p and q.
+static pair extension(const pair& P, const pair& dir, const pair& p,
+                      const pair& q)
+{
+  pair bd=q-p;
+  double det=dir.getx()*bd.gety()-dir.gety()*bd.getx();
+  if(det == 0.0) return p;
+  return P+((p.getx()-P.getx())*bd.gety()-(p.gety()-P.gety())*bd.getx())/
+    det*dir;
+}
+
+// Return true iff a and b lie strictly on opposite sides of the plane with
+// normal n passing through p, using the robust orientation predicate.
+static bool separated(const triple& n, const triple& p, const triple& a,
+                      const triple& b)
+{
+  triple u=cross(n,fabs(n.getx()) < fabs(n.gety()) ? triple(1,0,0) :
+                 triple(0,1,0));
+  triple v=cross(n,u);
+  double P0[]={p.getx(),p.gety(),p.getz()};
+  double P1[]={p.getx()+u.getx(),p.gety()+u.gety(),p.getz()+u.getz()};
+  double P2[]={p.getx()+v.getx(),p.gety()+v.gety(),p.getz()+v.getz()};
+  double A[]={a.getx(),a.gety(),a.getz()};
+  double B[]={b.getx(),b.gety(),b.getz()};
+  double sa=orient3d(P0,P1,P2,A);
+  double sb=orient3d(P0,P1,P2,B);
+  return (sa < 0 && sb > 0) || (sa > 0 && sb < 0);
+}
+
+// Sort the vertices of the convex polygon z according to whether they lie
+// on the left or right side of the line in the direction dir passing
+// through P, adding the points where the line crosses the boundary to both
+// halves. Points exactly on the line are considered to be on the right.
+static void half(const polygon& z, const pair& dir, const pair& P,
+                 polygon& left, polygon& right)
+{
+  size_t n=z.size();
+  if(n == 0) return;
+  pair invdir=dir.nonZero() ? 1.0/dir : pair(0.0,0.0);
+  double y=(invdir*P).gety();
+  bool last=(invdir*z[n-1]).gety() > y;
+  pair lastz=z[n-1];
+  for(size_t i=0; i < n; ++i) {
+    bool isleft=(invdir*z[i]).gety() > y;
+    if(isleft != last) {
+      pair w=extension(P,dir,lastz,z[i]);
+      left.push_back(w);
+      right.push_back(w);
+    }
+    if(isleft) left.push_back(z[i]);
+    else right.push_back(z[i]);
+    last=isleft;
+    lastz=z[i];
+  }
+}
+
+// Split face a by the plane of face cut. On return front and back indicate
+// which of the two pieces are present.
+static void split(bspface& a, const bspface& cut, const bspprojection& P,
+                  bspface& Front, bool& front, bspface& Back, bool& back)
+{
+  triple camera=P.camera;
+  if(P.infinity)
+    camera=camera*(factor*std::max(std::max(length(a.min),length(a.max)),
+                                   std::max(length(cut.min),
+                                            length(cut.max))));
+
+  front=back=false;
+
+  if(length(a.normal-cut.normal) < epsilon ||
+     length(a.normal+cut.normal) < epsilon) {
+    if(fabs(dot(a.point-camera,a.normal)) >=
+       fabs(dot(cut.point-camera,cut.normal))) {
+      Back=a; back=true;
+    } else {
+      Front=a; front=true;
+    }
+    return;
+  }
+
+  triple Lpoint=intersectionpoint(a.normal,a.point,cut.normal,cut.point);
+  triple Ldir=unit(cross(a.normal,cut.normal));
+
+  if(dot(camera-Lpoint,camera-P.target) < 0) {
+    if(fabs(dot(a.point-camera,a.normal)) >=
+       fabs(dot(cut.point-camera,cut.normal))) {
+      Back=a; back=true;
+    } else {
+      Front=a; front=true;
+    }
+    return;
+  }
+
+  pair point=a.t*project(Lpoint,P.T);
+  pair dir=a.t*project(Lpoint+Ldir,P.T)-point;
+  pair invdir=dir.nonZero() ? 1.0/dir : pair(0.0,0.0);
+  triple apoint=Lpoint+cross(Ldir,a.normal);
+  bool left=(invdir*(a.t*project(apoint,P.T))).gety() >=
+    (invdir*point).gety();
+
+  bool rightfront=left ^ !separated(cut.normal,cut.point,apoint,camera);
+
+  polygon Left,Right;
+  half(a.clip,dir,point,Left,Right);
+  polygon& frontclip=rightfront ? Right : Left;
+  polygon& backclip=rightfront ? Left : Right;
+
+  if(frontclip.size() >= 3) {
+    Front=a;
+    Front.split=Front.split || backclip.size() >= 3;
+    Front.clip.swap(frontclip);
+    front=true;
+  }
+  if(backclip.size() >= 3) {
+    Back=a;
+    Back.split=Back.split || front;
+    Back.clip.swap(backclip);
+    back=true;
+  }
+}
+
+void bsp(bspfaces& faces, const bspprojection& P, bspfaces& out)
+{
+  if(faces.empty()) return;
+
+  bspface node=faces.back();
+  faces.pop_back();
+
+  bspfaces Front,Back;
+  bspface front,back;
+  bool isfront,isback;
+  for(size_t i=0; i < faces.size(); ++i) {
+    split(faces[i],node,P,front,isfront,back,isback);
+    if(isfront) Front.push_back(front);
+    if(isback) Back.push_back(back);
+  }
+  faces.clear();
+
+  // Draw from back to front.
+  bsp(Back,P,out);
+  out.push_back(node);
+  bsp(Front,P,out);
+}
+
+} // namespace camp
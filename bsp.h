@@ -0,0 +1,41 @@
+/*****
+ * bsp.h
+ *
+ * Binary space partition of planar faces for hidden surface removal.
+ *****/
+
+#ifndef BSP_H
+#define BSP_H
+
+#include "common.h"
+#include "triple.h"
+#include "transform.h"
+
+namespace camp {
+
+typedef mem::vector<pair> polygon;
+
+struct bspface {
+  triple normal,point;  // plane of the face
+  triple min,max;       // bounding box of the face
+  transform t;          // maps projected points to frame coordinates
+  polygon clip;         // convex clipping region in frame coordinates
+  size_t index;         // index of the original face
+  bool split;           // whether the face has been clipped
+};
+
+typedef mem::vector<bspface> bspfaces;
+
+struct bspprojection {
+  double T[16];         // projection matrix
+  triple camera,target;
+  bool infinity;
+};
+
+// Split the faces by one another and append the resulting fragments to
+// out in back-to-front drawing order. The faces array is consumed.
+void bsp(bspfaces& faces, const bspprojection& P, bspfaces& out);
+
+} // namespace camp
+
+#endif
@@ -549,6 +549,11 @@ void addOrderedOps(venv &ve, ty *t1, ty *t2, ty *t3, ty *t4)
   
   addFunc(ve,searchArray<T>,primInt(),SYM(search),formal(t2,SYM(a)),
           formal(t1,SYM(key)));
+  addFunc(ve,searchArrays<T>,IntArray(),SYM(search),formal(t2,SYM(a)),
+          formal(t2,SYM(key)));
+  
+  addFunc(ve,argsortArray<T>,IntArray(),SYM(argsort),formal(t2,SYM(a)));
+  addFunc(ve,uniqueArray<T>,t2,SYM(unique),formal(t2,SYM(a)));
 }
 
 template<class T>
@@ -0,0 +1,92 @@
+/*****
+ * This file is automatically generated by findsym.pl
+ * Changes will be overwritten.
+ *****/
+
+// If the ADDSYMBOL macro is not already defined, define it with the default
+// purpose of referring to an external pre-translated symbol, such that
+// SYM(name) also refers to that symbol.
+#ifndef ADDSYMBOL
+    #define ADDSYMBOL(name) extern sym::symbol PRETRANSLATED_SYMBOL_##name
+    #define SYM(name) PRETRANSLATED_SYMBOL_##name
+#endif
+
+ADDSYMBOL(VERSION);
+ADDSYMBOL(a);
+ADDSYMBOL(abs);
+ADDSYMBOL(acos);
+ADDSYMBOL(acosh);
+ADDSYMBOL(alias);
+ADDSYMBOL(argsort);
+ADDSYMBOL(array);
+ADDSYMBOL(asin);
+ADDSYMBOL(asinh);
+ADDSYMBOL(atan);
+ADDSYMBOL(atanh);
+ADDSYMBOL(b);
+ADDSYMBOL(cbrt);
+ADDSYMBOL(concat);
+ADDSYMBOL(conj);
+ADDSYMBOL(copy);
+ADDSYMBOL(cos);
+ADDSYMBOL(cosh);
+ADDSYMBOL(currentpen);
+ADDSYMBOL(depth);
+ADDSYMBOL(diagonal);
+ADDSYMBOL(e);
+ADDSYMBOL(exp);
+ADDSYMBOL(expm1);
+ADDSYMBOL(f);
+ADDSYMBOL(fabs);
+ADDSYMBOL(file);
+ADDSYMBOL(identity);
+ADDSYMBOL(inf);
+ADDSYMBOL(infinity);
+ADDSYMBOL(intMax);
+ADDSYMBOL(intMin);
+ADDSYMBOL(interp);
+ADDSYMBOL(key);
+ADDSYMBOL(ldexp);
+ADDSYMBOL(less);
+ADDSYMBOL(log);
+ADDSYMBOL(log10);
+ADDSYMBOL(log1p);
+ADDSYMBOL(map);
+ADDSYMBOL(max);
+ADDSYMBOL(maxbound);
+ADDSYMBOL(min);
+ADDSYMBOL(minbound);
+ADDSYMBOL(n);
+ADDSYMBOL(nan);
+ADDSYMBOL(perm);
+ADDSYMBOL(pi);
+ADDSYMBOL(pow10);
+ADDSYMBOL(printBytecode);
+ADDSYMBOL(randMax);
+ADDSYMBOL(realDigits);
+ADDSYMBOL(realEpsilon);
+ADDSYMBOL(realMax);
+ADDSYMBOL(realMin);
+ADDSYMBOL(s);
+ADDSYMBOL(search);
+ADDSYMBOL(sequence);
+ADDSYMBOL(sin);
+ADDSYMBOL(sinh);
+ADDSYMBOL(sort);
+ADDSYMBOL(sqrt);
+ADDSYMBOL(suffix);
+ADDSYMBOL(sum);
+ADDSYMBOL(t);
+ADDSYMBOL(tan);
+ADDSYMBOL(tanh);
+ADDSYMBOL(transpose);
+ADDSYMBOL(unique);
+ADDSYMBOL(value);
+ADDSYMBOL(write);
+ADDSYMBOL(x);
+ADDSYMBOL(xx);
+ADDSYMBOL(xy);
+ADDSYMBOL(y);
+ADDSYMBOL(yx);
+ADDSYMBOL(yy);
+ADDSYMBOL(z);
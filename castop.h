@@ -10,6 +10,7 @@
 #define CASTOP_H
 
 #include <cfloat>
+#include <vector>
 
 #include "common.h"
 #include "stack.h"
@@ -114,6 +115,94 @@ inline void reportEof(camp::file *f, Int count)
   }
 }
 
+// Operations on files used only for reading arrays of numbers.
+template<class T>
+struct numberfile {
+  static void map(camp::file *) {}
+  static void unmap(camp::file *) {}
+  static bool readBlocks(camp::file *, vm::array *, Int, Int, Int) {
+    return false;
+  }
+};
+
+template<class T>
+struct numbers {
+  static void map(camp::file *f) {f->map();}
+  static void unmap(camp::file *f) {f->unmap();}
+  
+  // Read n values (or all remaining values if n is zero) in blocks,
+  // appending them to c. Return the number of values read, or -1 if the
+  // values must be read one at a time.
+  static Int readBlocks(camp::file *f, vm::array *c, Int n) {
+    static const size_t blocksize=65536;
+    std::vector<T> v(n == 0 ? blocksize : std::min((size_t) n,blocksize));
+    Int count=0;
+    for(;;) {
+      size_t m=n == 0 ? blocksize : std::min((size_t) (n-count),blocksize);
+      if(m == 0) break;
+      Int k=f->readblock(&v[0],m);
+      if(k < 0) return -1;
+      for(Int i=0; i < k; ++i) c->push(v[i]);
+      count += k;
+      if((size_t) k < m) break;
+    }
+    return count;
+  }
+  
+  // Read a one-dimensional array, or an array with fixed dimensions, of
+  // binary or XDR values in blocks. Return false if the values must be
+  // read one at a time.
+  static bool readBlocks(camp::file *f, vm::array *c, Int nx, Int ny,
+                         Int nz) {
+    if(ny < 0) {
+      Int count=readBlocks(f,c,nx > 0 ? nx : 0);
+      if(count < 0) return false;
+      if(nx > 0 && count < nx) reportEof(f,count);
+      return true;
+    }
+    if(nx <= 0 || ny == 0 || nz == 0) return false;
+    Int nyz=nz > 0 ? ny*nz : ny;
+    vm::array *a=new vm::array(0);
+    Int count=readBlocks(f,a,nx*nyz);
+    if(count < 0) return false;
+    if(count < nx*nyz) {
+      reportEof(f,count);
+      return true;
+    }
+    size_t k=0;
+    for(Int i=0; i < nx; i++) {
+      vm::array *ci=new vm::array(ny);
+      for(Int j=0; j < ny; j++) {
+        if(nz > 0) {
+          vm::array *cij=new vm::array(nz);
+          for(Int l=0; l < nz; l++) (*cij)[l]=(*a)[k++];
+          (*ci)[j]=cij;
+        } else (*ci)[j]=(*a)[k++];
+      }
+      c->push(ci);
+    }
+    return true;
+  }
+};
+
+template<>
+struct numberfile<Int> : public numbers<Int> {};
+
+template<>
+struct numberfile<double> : public numbers<double> {};
+
+// Arrays of numbers that may span many lines are read from a copy of the
+// file mapped into memory.
+template<class T>
+struct mappedfile {
+  camp::file *f;
+  bool mapped;
+  mappedfile(camp::file *f, bool mapped) : f(f), mapped(mapped) {
+    if(mapped) numberfile<T>::map(f);
+  }
+  ~mappedfile() {if(mapped) numberfile<T>::unmap(f);}
+};
+
 template<class T>
 void readArray(vm::stack *s, Int nx=-1, Int ny=-1, Int nz=-1)
 {
@@ -126,6 +215,11 @@ void readArray(vm::stack *s, Int nx=-1, Int ny=-1, Int nz=-1)
     if(ny == -2) {f->read(ny); f->Ny(-1); if(ny == 0) {s->push(c); return;}}
     if(nz != -1 && f->Nz() != -1) nz=f->Nz();
     if(nz == -2) {f->read(nz); f->Nz(-1); if(nz == 0) {s->push(c); return;}}
+    if(!f->LineMode() && numberfile<T>::readBlocks(f,c,nx,ny,nz)) {
+      s->push(c);
+      return;
+    }
+    mappedfile<T> mapped(f,!f->LineMode() || ny >= 0);
     T v;
     if(nx >= 0) {
       for(Int i=0; i < Limit(nx); i++) {
@@ -143,6 +143,9 @@ public:
 
   virtual bool islayer() {return false;}
 
+// Change the path simplification tolerance?
+  virtual bool simplify() {return false;}
+
   virtual bool is3D() {return false;}
 
 // Implement element as raw SVG code?
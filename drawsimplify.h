@@ -0,0 +1,57 @@
+/*****
+ * drawsimplify.h
+ *
+ * Set the tolerance for simplifying straight path segments in the rest of
+ * the picture, restoring it where the picture ends.
+ *****/
+
+#ifndef DRAWSIMPLIFY_H
+#define DRAWSIMPLIFY_H
+
+#include "drawelement.h"
+
+namespace camp {
+
+class drawSimplify : public drawElement {
+  double tolerance;
+public:
+  drawSimplify(double tolerance) : tolerance(tolerance) {}
+  virtual ~drawSimplify() {}
+
+  bool simplify() {return true;}
+
+  bool draw(psfile *out) {
+    out->tolerance=tolerance;
+    return true;
+  }
+  
+  bool write(texfile *out, const bbox&) {
+    out->tolerance=tolerance;
+    return true;
+  }
+};
+
+// Mark the beginning or end of a picture that changes the tolerance.
+class drawSimplifyScope : public drawElement {
+  bool begin;
+public:
+  drawSimplifyScope(bool begin) : begin(begin) {}
+  virtual ~drawSimplifyScope() {}
+
+  bool draw(psfile *out) {
+    if(begin) out->savetolerance();
+    else out->restoretolerance();
+    return true;
+  }
+  
+  bool write(texfile *out, const bbox&) {
+    return draw(out);
+  }
+};
+
+}
+
+GC_DECLARE_PTRFREE(camp::drawSimplify);
+GC_DECLARE_PTRFREE(camp::drawSimplifyScope);
+
+#endif
@@ -372,6 +372,7 @@ void drawSurface::render(GLUnurbs *nurb, double size2,
     else
       store(Normal,normal);
 
+    gl::Ntriangles += 2;
     glBegin(GL_QUADS);
     if(lighton)
       glNormal3fv(Normal);
@@ -1073,6 +1074,7 @@ void drawTriangles::render(GLUnurbs *nurb, double size2, const triple& Min,
   setcolors(nC,!nC,diffuse,ambient,emissive,specular,shininess);
   if(!nN) lighton=false;
   
+  gl::Ntriangles += nI;
   glBegin(GL_TRIANGLES);
   for(size_t i=0; i < nI; i++) {
     const uint32_t *pi=PI[i];
@@ -5,8 +5,24 @@
  * Handle input/output
  ******/
 
+#include <cfloat>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <algorithm>
+#include <limits>
+#include <clocale>
+
 #include "fileio.h"
 #include "settings.h"
+#include "numformat.h"
+
+#ifdef HAVE_MMAP
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
 
 namespace camp {
 
@@ -97,6 +113,325 @@ void ifile::csv()
   if(c == ',') comma=true;
 }
   
+#ifdef HAVE_PTHREAD
+const size_t prefetchbuf::blocksize;
+const size_t prefetchbuf::putback;
+
+prefetchbuf::prefetchbuf(std::streambuf *source) :
+  source(source), offset(0), current(0), holding(false), ended(false),
+  stopping(false), started(false)
+{
+  for(size_t i=0; i < 2; ++i) {
+    blocks[i].data=new char[putback+blocksize];
+    blocks[i].length=0;
+    blocks[i].full=false;
+  }
+  pthread_mutex_init(&lock,NULL);
+  pthread_cond_init(&cond,NULL);
+}
+
+prefetchbuf::~prefetchbuf()
+{
+  stop();
+  pthread_cond_destroy(&cond);
+  pthread_mutex_destroy(&lock);
+  for(size_t i=0; i < 2; ++i)
+    delete[] blocks[i].data;
+}
+
+bool prefetchbuf::start(std::streamoff pos)
+{
+  offset=pos;
+  current=0;
+  holding=false;
+  ended=stopping=false;
+  for(size_t i=0; i < 2; ++i)
+    blocks[i].full=false;
+  setg(NULL,NULL,NULL);
+  started=pthread_create(&thread,NULL,fill,this) == 0;
+  if(started) ++helperthreads;
+  return started;
+}
+
+// Stop the background thread, leaving the source positioned at the next
+// character to be consumed.
+void prefetchbuf::stop()
+{
+  if(!started) return;
+  pthread_mutex_lock(&lock);
+  stopping=true;
+  pthread_cond_broadcast(&cond);
+  pthread_mutex_unlock(&lock);
+  pthread_join(thread,NULL);
+  --helperthreads;
+  started=false;
+  source->pubseekpos(position(),std::ios::in);
+}
+
+std::streamoff prefetchbuf::position()
+{
+  return holding ? offset+(gptr()-(blocks[current].data+putback)) : offset;
+}
+
+void *prefetchbuf::fill(void *buf)
+{
+  ((prefetchbuf *) buf)->fill();
+  return NULL;
+}
+
+void prefetchbuf::fill()
+{
+  for(size_t next=0;; next=1-next) {
+    block& b=blocks[next];
+    pthread_mutex_lock(&lock);
+    while(b.full && !stopping)
+      pthread_cond_wait(&cond,&lock);
+    bool stop=stopping;
+    pthread_mutex_unlock(&lock);
+    if(stop) return;
+    
+    std::streamsize n=source->sgetn(b.data+putback,blocksize);
+    pthread_mutex_lock(&lock);
+    if(n > 0) {
+      b.length=n;
+      b.full=true;
+    }
+    if(n < (std::streamsize) blocksize) ended=true;
+    pthread_cond_broadcast(&cond);
+    pthread_mutex_unlock(&lock);
+    if(ended) return;
+  }
+}
+
+prefetchbuf::int_type prefetchbuf::underflow()
+{
+  if(gptr() < egptr()) return traits_type::to_int_type(*gptr());
+  if(!started) return traits_type::eof();
+  
+  size_t next=holding ? 1-current : current;
+  block& b=blocks[next];
+  pthread_mutex_lock(&lock);
+  while(!b.full && !ended)
+    pthread_cond_wait(&cond,&lock);
+  bool full=b.full;
+  pthread_mutex_unlock(&lock);
+  if(!full) return traits_type::eof();
+  
+  // Keep the end of the previous block available for putback.
+  char *begin=b.data+putback;
+  size_t n=0;
+  if(holding) {
+    block& last=blocks[current];
+    n=std::min((size_t) (egptr()-eback()),putback);
+    memcpy(begin-n,egptr()-n,n);
+    offset += last.length;
+    pthread_mutex_lock(&lock);
+    last.full=false;
+    pthread_cond_broadcast(&cond);
+    pthread_mutex_unlock(&lock);
+  }
+  current=next;
+  holding=true;
+  setg(begin-n,begin,begin+b.length);
+  return traits_type::to_int_type(*gptr());
+}
+
+prefetchbuf::pos_type prefetchbuf::seekoff(off_type off,
+                                           std::ios::seekdir dir,
+                                           std::ios::openmode which)
+{
+  if(dir == std::ios::cur) {
+    if(off == 0) return position();
+    off += position();
+    dir=std::ios::beg;
+  }
+  stop();
+  pos_type pos=source->pubseekoff(off,dir,std::ios::in);
+  start(pos == pos_type(off_type(-1)) ?
+        source->pubseekoff(0,std::ios::cur,std::ios::in) : pos);
+  return pos;
+}
+#endif
+
+void prefetchstream::prefetch(bool b)
+{
+#ifdef HAVE_PTHREAD
+  if(b && !buffer && good()) {
+    std::filebuf *source=std::fstream::rdbuf();
+    buffer=new prefetchbuf(source);
+    if(buffer->start(source->pubseekoff(0,std::ios::cur,std::ios::in)))
+      std::ios::rdbuf(buffer);
+    else {
+      delete buffer;
+      buffer=NULL;
+    }
+  } else if(!b && buffer) {
+    std::ios::iostate state=rdstate();
+    delete buffer;
+    buffer=NULL;
+    std::ios::rdbuf(std::fstream::rdbuf());
+    clear(state);
+  }
+#endif
+}
+
+#ifdef HAVE_MMAP
+// Smaller remainders are read faster through the file buffer.
+const off_t mapminimum=65536;
+#endif
+
+void ifile::map()
+{
+#ifdef HAVE_MMAP
+  if(buffer || standard || binary || !fstream || (mode & std::ios::out) ||
+     !fstream->good()) return;
+  std::streamoff pos=fstream->tellg();
+  if(pos < 0) return;
+  int fd=::open(name.c_str(),O_RDONLY);
+  if(fd < 0) return;
+  struct stat buf;
+  if(fstat(fd,&buf) == 0 && S_ISREG(buf.st_mode) &&
+     buf.st_size-pos >= mapminimum) {
+    // Map only the remainder of the file, starting on a page boundary.
+    off_t start=pos-pos % sysconf(_SC_PAGESIZE);
+    mappingsize=buf.st_size-start;
+    mapping=mmap(NULL,mappingsize,PROT_READ,MAP_PRIVATE,fd,start);
+    if(mapping != MAP_FAILED) {
+      madvise(mapping,mappingsize,MADV_SEQUENTIAL);
+      char *begin=(char *) mapping;
+      buffer=new memorybuf(begin,begin+(pos-start),begin+mappingsize);
+      stream=new istream(buffer);
+      mappingstart=start;
+    }
+  }
+  ::close(fd);
+#endif
+}
+
+void ifile::unmap()
+{
+#ifdef HAVE_MMAP
+  if(!buffer) return;
+  std::ios::iostate state=stream->rdstate();
+  size_t offset=buffer->offset();
+  delete stream;
+  delete buffer;
+  buffer=NULL;
+  munmap(mapping,mappingsize);
+  stream=fstream;
+  fstream->clear();
+  fstream->seekg(mappingstart+offset);
+  fstream->clear(state);
+#endif
+}
+
+// Read an integer from the mapped file, accepting the same syntax as the
+// decimal extraction operator.
+void ifile::readinteger(Int& val)
+{
+  istream::sentry s(*stream);
+  if(!s) return;
+  const char *p=buffer->next(), *end=buffer->end();
+  bool negative=false;
+  if(*p == '-' || *p == '+') {
+    negative=(*p == '-');
+    ++p;
+  }
+  const char *digits=p;
+  unsignedInt limit=std::numeric_limits<Int>::max();
+  if(negative) ++limit;
+  unsignedInt result=0;
+  bool overflow=false;
+  for(; p < end && *p >= '0' && *p <= '9'; ++p) {
+    unsigned d=*p-'0';
+    if(result > (limit-d)/10) overflow=true;
+    else result=10*result+d;
+  }
+  std::ios::iostate state=std::ios::goodbit;
+  if(p == digits) {
+    val=0;
+    state=std::ios::failbit;
+  } else if(overflow) {
+    val=negative ? std::numeric_limits<Int>::min() :
+      std::numeric_limits<Int>::max();
+    state=std::ios::failbit;
+  } else val=negative ? (Int) -result : (Int) result;
+  if(p == end) state |= std::ios::eofbit;
+  buffer->skip(p-buffer->next());
+  stream->setstate(state);
+}
+
+// Read a real number from the mapped file, accepting the same syntax as the
+// extraction operator. Numbers with at most 19 significant digits and small
+// exponents are converted exactly without calling strtod.
+void ifile::readreal(double& val)
+{
+  static const double power[]={1e0,1e1,1e2,1e3,1e4,1e5,1e6,1e7,1e8,1e9,
+                               1e10,1e11,1e12,1e13,1e14,1e15,1e16,1e17,
+                               1e18,1e19,1e20,1e21,1e22};
+  istream::sentry s(*stream);
+  if(!s) return;
+  const char *start=buffer->next(), *end=buffer->end();
+  const char *p=start;
+  bool negative=false;
+  if(*p == '-' || *p == '+') {
+    negative=(*p == '-');
+    ++p;
+  }
+  unsigned long long mantissa=0;
+  int significant=0, exponent=0;
+  bool found_mantissa=false;
+  bool dot=false;
+  for(; p < end; ++p) {
+    char c=*p;
+    if(c >= '0' && c <= '9') {
+      found_mantissa=true;
+      if(mantissa || c != '0') {
+        if(significant < 19) mantissa=10*mantissa+(c-'0');
+        else ++exponent;
+        ++significant;
+      }
+      if(dot) --exponent;
+    } else if(c == '.' && !dot) dot=true;
+    else break;
+  }
+  bool valid=found_mantissa;
+  if(valid && p < end && (*p == 'e' || *p == 'E')) {
+    ++p;
+    bool negativeexponent=false;
+    if(p < end && (*p == '-' || *p == '+')) {
+      negativeexponent=(*p == '-');
+      ++p;
+    }
+    const char *digits=p;
+    int e=0;
+    for(; p < end && *p >= '0' && *p <= '9'; ++p)
+      if(e < 100000) e=10*e+(*p-'0');
+    if(p == digits) valid=false;
+    exponent += negativeexponent ? -e : e;
+  }
+
+  std::ios::iostate state=std::ios::goodbit;
+  if(!valid) {
+    val=0.0;
+    state=std::ios::failbit;
+  } else if(significant <= 19 && mantissa <= (1ULL << 53) &&
+            exponent >= -22 && exponent <= 22) {
+    val=exponent < 0 ? mantissa/power[-exponent] : mantissa*power[exponent];
+    if(negative) val=-val;
+  } else {
+    string token(start,p);
+    val=strtod(token.c_str(),NULL);
+    if(val == HUGE_VAL || val == -HUGE_VAL) {
+      val=val > 0 ? DBL_MAX : -DBL_MAX;
+      state=std::ios::failbit;
+    }
+  }
+  if(p == end) state |= std::ios::eofbit;
+  buffer->skip(p-start);
+  stream->setstate(state);
+}
+
 void ifile::Read(string& val)
 {
   string s;
@@ -173,5 +508,170 @@ void ofile::writeline()
   } else *stream << newline;
   if(errorstream::interrupt) {interact::lines=0; throw interrupted();}
 }
+
+const size_t blockwriter::blocksize;
+
+blockwriter::blockwriter(ostream *stream, bool async) :
+  stream(stream), digits(stream->precision()), current(0), length(0),
+  async(async)
+{
+  if(digits < 0) digits=6;
+  point=*localeconv()->decimal_point;
+  limit=std::pow(10.0,std::min(std::max(digits,1),15));
+  // The %g format prints at most the 767 significant digits of the
+  // exact value of a double.
+  room=std::min(digits,800)+24;
+  for(size_t i=0; i < 2; ++i)
+    blocks[i]=new char[blocksize+room];
+#ifdef HAVE_PTHREAD
+  pending=0;
+  stopping=false;
+  if(async) {
+    pthread_mutex_init(&lock,NULL);
+    pthread_cond_init(&cond,NULL);
+    if(pthread_create(&thread,NULL,drain,this) != 0) {
+      pthread_cond_destroy(&cond);
+      pthread_mutex_destroy(&lock);
+      this->async=false;
+    } else ++helperthreads;
+  }
+#else
+  this->async=false;
+#endif
+}
+
+blockwriter::~blockwriter()
+{
+  flush();
+#ifdef HAVE_PTHREAD
+  if(async) {
+    pthread_mutex_lock(&lock);
+    stopping=true;
+    pthread_cond_broadcast(&cond);
+    pthread_mutex_unlock(&lock);
+    pthread_join(thread,NULL);
+    --helperthreads;
+    pthread_cond_destroy(&cond);
+    pthread_mutex_destroy(&lock);
+  }
+#endif
+  for(size_t i=0; i < 2; ++i)
+    delete[] blocks[i];
+}
+
+#ifdef HAVE_PTHREAD
+void *blockwriter::drain(void *writer)
+{
+  ((blockwriter *) writer)->drain();
+  return NULL;
+}
+
+// Write the blocks handed over by next, which alternate between the two
+// blocks starting with the first.
+void blockwriter::drain()
+{
+  for(size_t i=0;; i=1-i) {
+    pthread_mutex_lock(&lock);
+    while(!pending && !stopping)
+      pthread_cond_wait(&cond,&lock);
+    size_t n=pending;
+    pthread_mutex_unlock(&lock);
+    if(n == 0) return;
+    stream->write(blocks[i],n);
+    pthread_mutex_lock(&lock);
+    pending=0;
+    pthread_cond_broadcast(&cond);
+    pthread_mutex_unlock(&lock);
+  }
+}
+#endif
+
+void blockwriter::next()
+{
+  if(length == 0) return;
+#ifdef HAVE_PTHREAD
+  if(async) {
+    pthread_mutex_lock(&lock);
+    while(pending)
+      pthread_cond_wait(&cond,&lock);
+    pending=length;
+    pthread_cond_broadcast(&cond);
+    pthread_mutex_unlock(&lock);
+    current=1-current;
+    length=0;
+    return;
+  }
+#endif
+  stream->write(blocks[current],length);
+  length=0;
+}
+
+void blockwriter::flush()
+{
+  next();
+#ifdef HAVE_PTHREAD
+  if(async) {
+    pthread_mutex_lock(&lock);
+    while(pending)
+      pthread_cond_wait(&cond,&lock);
+    pthread_mutex_unlock(&lock);
+  }
+#endif
+  stream->flush();
+}
+
+void blockwriter::write(Int x)
+{
+  char buf[24];
+  char *p=buf+sizeof(buf);
+  unsignedInt u=x < 0 ? -(unsignedInt) x : x;
+  do {
+    *--p='0'+u % 10;
+    u /= 10;
+  } while(u);
+  if(x < 0) *--p='-';
+  size_t n=buf+sizeof(buf)-p;
+  memcpy(blocks[current]+length,p,n);
+  length += n;
+  if(length >= blocksize) next();
+}
+
+// Format x like an ostream with the default floating-point format, namely
+// as printf does with %.*g in the C locale.
+void blockwriter::write(double x)
+{
+  // Integers with at most digits digits are printed without an exponent
+  // or decimal point.
+  if(x == floor(x) && fabs(x) < limit && (x != 0 || !std::signbit(x))) {
+    write((Int) x);
+    return;
+  }
+  char *p=blocks[current]+length;
+  size_t m=formatnumber(p,x,digits,false);
+  if(m) length += m;
+  else {
+    int n=snprintf(p,room,"%.*g",digits,x);
+    if(point != '.') {
+      char *q=(char *) memchr(p,point,n);
+      if(q) *q='.';
+    }
+    length += n;
+  }
+  if(length >= blocksize) next();
+}
+
+void blockwriter::write(const string& s)
+{
+  const char *p=s.data();
+  size_t n=s.size();
+  while(n > 0) {
+    size_t m=std::min(n,blocksize-length);
+    memcpy(blocks[current]+length,p,m);
+    length += m;
+    p += m;
+    n -= m;
+    if(length >= blocksize) next();
+  }
+}
   
 } // namespace camp
@@ -11,6 +11,7 @@
 #include <fstream>
 #include <iostream>
 #include <sstream>
+#include <vector>
 
 #include "common.h"
 
@@ -39,12 +40,13 @@ extern string tab;
 extern string newline;
   
 enum Mode {NOMODE,INPUT,OUTPUT,UPDATE,BINPUT,BOUTPUT,BUPDATE,XINPUT,XOUTPUT,
-           XUPDATE,OPIPE};
+           XUPDATE,OPIPE,AINPUT};
 
 static const string FileModes[]=
 {"none","input","output","output(update)",
  "input(binary)","output(binary)","output(binary,update)",
- "input(xdr)","output(xdr)","output(xdr,update)","output(pipe)"};
+ "input(xdr)","output(xdr)","output(xdr,update)","output(pipe)",
+ "input(arrow)"};
 
 extern FILE *pipeout;
 
@@ -147,6 +149,7 @@ public:
   }
                 
   string filename() {return name;}
+  bool Binary() {return binary;}
   virtual bool eol() {return false;}
   virtual bool nexteol() {return false;}
   virtual bool text() {return false;}
@@ -159,6 +162,19 @@ public:
   virtual size_t tell() {return 0;}
   virtual void seek(Int, bool=true) {}
   
+  // Read subsequent text from a copy of the file mapped into memory, until
+  // unmap is called.
+  virtual void map() {}
+  virtual void unmap() {}
+  
+  virtual void Prefetch(bool) {}
+  virtual bool Prefetch() {return false;}
+  
+  // Read up to n reals or integers in a single operation, returning the
+  // number read, or -1 if the values must be read one at a time.
+  virtual Int readblock(double *, size_t) {return -1;}
+  virtual Int readblock(Int *, size_t) {return -1;}
+  
   string FileMode() {return FileModes[type];}
   
   void unsupported(const char *rw, const char *type) {
@@ -327,24 +343,120 @@ public:
   }
 };
 
+// A read-only stream buffer over a file mapped into memory.
+class memorybuf : public std::streambuf {
+public:
+  memorybuf(char *begin, char *next, char *end) {setg(begin,next,end);}
+  
+  const char *next() {return gptr();}
+  const char *end() {return egptr();}
+  void skip(size_t n) {gbump((int) n);}
+  size_t offset() {return gptr()-eback();}
+};
+
+#ifdef HAVE_PTHREAD
+// A stream buffer that reads ahead from another stream buffer in a
+// background thread, which fills one block while the other is consumed.
+class prefetchbuf : public std::streambuf {
+  static const size_t blocksize=1048576;
+  static const size_t putback=16;
+  
+  struct block {
+    char *data;
+    size_t length;
+    bool full;
+  };
+  
+  std::streambuf *source;
+  std::streamoff offset; // Source position of the block being consumed.
+  block blocks[2];
+  size_t current;
+  bool holding;          // Is the get area in blocks[current]?
+  bool ended;            // Has the source been exhausted?
+  bool stopping;
+  bool started;
+  pthread_t thread;
+  pthread_mutex_t lock;
+  pthread_cond_t cond;
+  
+  static void *fill(void *buf);
+  void fill();
+  void stop();
+  
+protected:
+  int_type underflow();
+  pos_type seekoff(off_type off, std::ios::seekdir dir,
+                   std::ios::openmode which=std::ios::in);
+  pos_type seekpos(pos_type pos, std::ios::openmode which=std::ios::in) {
+    return seekoff(pos,std::ios::beg,which);
+  }
+  
+public:
+  prefetchbuf(std::streambuf *source);
+  ~prefetchbuf();
+  
+  // Start reading ahead from position pos, returning false on failure.
+  bool start(std::streamoff pos);
+  std::streamoff position();
+};
+#endif
+
+// A file stream that can read ahead in a background thread.
+class prefetchstream : public std::fstream {
+#ifdef HAVE_PTHREAD
+  prefetchbuf *buffer;
+#endif
+public:
+  prefetchstream(const char *name, std::ios::openmode mode) :
+    std::fstream(name,mode)
+#ifdef HAVE_PTHREAD
+    , buffer(NULL)
+#endif
+  {}
+  
+  ~prefetchstream() {prefetch(false);}
+  
+  void prefetch(bool b);
+  bool prefetching() {
+#ifdef HAVE_PTHREAD
+    return buffer != NULL;
+#else
+    return false;
+#endif
+  }
+  
+  void close() {
+    prefetch(false);
+    std::fstream::close();
+  }
+};
+
 class ifile : public file {
 protected:  
   istream *stream;
-  std::fstream *fstream;
+  prefetchstream *fstream;
   char comment;
   std::ios::openmode mode;
   bool comma;
   
+  memorybuf *buffer; // Non-null while the file is mapped into memory.
+  void *mapping;
+  size_t mappingsize;
+  size_t mappingstart;
+  
+  void readinteger(Int& val);
+  void readreal(double& val);
+  
 public:
   ifile(const string& name, char comment, bool check=true, Mode type=INPUT, 
         std::ios::openmode mode=std::ios::in) :
     file(name,check,type), stream(&cin), fstream(NULL), comment(comment),
-    mode(mode), comma(false) {}
+    mode(mode), comma(false), buffer(NULL) {}
   
   // Binary file
   ifile(const string& name, bool check=true, Mode type=BINPUT,
         std::ios::openmode mode=std::ios::in) :
-    file(name,check,type,true), mode(mode) {}
+    file(name,check,type,true), mode(mode), buffer(NULL) {}
   
   ~ifile() {close();}
   
@@ -356,13 +468,13 @@ public:
     } else {
       if(mode & std::ios::out)
         name=outpath(name);
-      stream=fstream=new std::fstream(name.c_str(),mode);
+      stream=fstream=new prefetchstream(name.c_str(),mode);
       if(mode & std::ios::out) {
         if(error()) {
           delete fstream;
           std::ofstream f(name.c_str());
           f.close();
-          stream=fstream=new std::fstream(name.c_str(),mode);
+          stream=fstream=new prefetchstream(name.c_str(),mode);
         }
       }
       index=processData().ifile.add(fstream);
@@ -379,6 +491,7 @@ public:
   
   void close() {
     if(!standard && fstream) {
+      unmap();
       fstream->close();
       closed=true;
       delete fstream;
@@ -391,12 +504,15 @@ public:
   
   void seek(Int pos, bool begin=true) {
     if(!standard && fstream) {
+      unmap();
       clear();
       fstream->seekg(pos,begin ? std::ios::beg : std::ios::end);
     }
   }
   
   size_t tell() {
+    if(buffer)
+      return mappingstart+buffer->offset();
     if(fstream) 
       return fstream->tellg();
     else
@@ -405,14 +521,25 @@ public:
   
   void csv();
   
+  void map();
+  void unmap();
+  
+  void Prefetch(bool b) {
+    if(!standard && fstream && !(mode & std::ios::out)) {
+      unmap();
+      fstream->prefetch(b);
+    }
+  }
+  bool Prefetch() {return fstream && fstream->prefetching();}
+  
   virtual void ignoreComment();
   
   // Skip over white space
   void readwhite(string& val) {val=string(); *stream >> val;}
   
   void Read(bool &val) {string t; readwhite(t); val=(t == "true");}
-  void Read(Int& val) {*stream >> val;}
-  void Read(double& val) {*stream >> val;}
+  void Read(Int& val) {if(buffer) readinteger(val); else *stream >> val;}
+  void Read(double& val) {if(buffer) readreal(val); else *stream >> val;}
   void Read(pair& val) {*stream >> val;}
   void Read(triple& val) {*stream >> val;}
   void Read(char& val) {stream->get(val);}
@@ -517,6 +644,50 @@ public:
   void write(const transform& val) {*stream << val;}
   
   void writeline();
+  
+  // Return the stream of a file other than standard output.
+  std::ofstream *Stream() {return fstream;}
+};
+
+// Formats numbers and strings into large blocks, each of which is written
+// to a stream in a single operation. In asynchronous mode, a background
+// thread writes each block while the next one is formatted.
+class blockwriter {
+  static const size_t blocksize=1048576;
+  
+  ostream *stream;
+  int digits;      // Precision of the stream.
+  char point;      // Decimal point of the C library locale.
+  size_t room;     // Maximum length of a formatted number.
+  double limit;    // Integers below limit are formatted directly.
+  char *blocks[2];
+  size_t current;
+  size_t length;   // Length of blocks[current].
+  bool async;
+  
+#ifdef HAVE_PTHREAD
+  size_t pending;  // Length of the block waiting to be written.
+  bool stopping;
+  pthread_t thread;
+  pthread_mutex_t lock;
+  pthread_cond_t cond;
+  
+  static void *drain(void *writer);
+  void drain();
+#endif
+  
+  // Write out blocks[current] and switch to the other block.
+  void next();
+  
+public:
+  blockwriter(ostream *stream, bool async=false);
+  ~blockwriter();
+  
+  void write(double x);
+  void write(Int x);
+  void write(const string& s);
+  
+  void flush();
 };
 
 class ibfile : public ifile {
@@ -547,6 +718,41 @@ public:
     if(singlereal) {float fval; iread(fval); val=fval;}
     else iread(val);
   }
+  
+  template<class T>
+  Int iread(T *v, size_t n) {
+    if(!fstream) return 0;
+    fstream->read((char *) v,n*sizeof(T));
+    return fstream->gcount()/sizeof(T);
+  }
+  
+  // Read n values of type S and convert them to type T.
+  template<class S, class T>
+  Int iread(T *v, size_t n) {
+    std::vector<S> u(n);
+    Int m=iread(&u[0],n);
+    for(Int i=0; i < m; ++i) v[i]=u[i];
+    return m;
+  }
+  
+  Int readblock(Int *v, size_t n) {
+    if(signedint) return singleint ? iread<int>(v,n) : iread(v,n);
+    Int m;
+    if(singleint) {
+      std::vector<unsigned> u(n);
+      m=iread(&u[0],n);
+      for(Int i=0; i < m; ++i) v[i]=Intcast(u[i]);
+    } else {
+      unsignedInt *u=(unsignedInt *) v;
+      m=iread(u,n);
+      for(Int i=0; i < m; ++i) v[i]=Intcast(u[i]);
+    }
+    return m;
+  }
+  
+  Int readblock(double *v, size_t n) {
+    return singlereal ? iread<float>(v,n) : iread(v,n);
+  }
 };
   
 class iobfile : public ibfile {
@@ -708,6 +914,44 @@ public:
     Read(z);
     val=triple(x,y,z);
   }
+  
+  // Read n values of type S and convert them to type T.
+  template<class S, class T>
+  Int xread(T *v, size_t n) {
+    std::vector<S> u(n);
+    Int m=fstream->read(&u[0],n);
+    for(Int i=0; i < m; ++i) v[i]=u[i];
+    return m;
+  }
+  
+  Int readblock(Int *v, size_t n) {
+    if(!fstream) return 0;
+    if(signedint) {
+      if(singleint) return xread<int>(v,n);
+#ifdef HAVE_LONG_LONG
+      return fstream->read(v,n);
+#endif
+    } else {
+      if(singleint) {
+        std::vector<unsigned> u(n);
+        Int m=fstream->read(&u[0],n);
+        for(Int i=0; i < m; ++i) v[i]=Intcast(u[i]);
+        return m;
+      }
+#ifdef HAVE_LONG_LONG
+      unsignedInt *u=(unsignedInt *) v;
+      Int m=fstream->read(u,n);
+      for(Int i=0; i < m; ++i) v[i]=Intcast(u[i]);
+      return m;
+#endif
+    }
+    return -1;
+  }
+  
+  Int readblock(double *v, size_t n) {
+    if(!fstream) return 0;
+    return singlereal ? xread<float>(v,n) : fstream->read(v,n);
+  }
 };
 
 class ioxfile : public ixfile {
@@ -79,6 +79,15 @@ bool Step;
 
 bool queueScreen=false;
 
+// Progressive level of detail while the camera is moving.
+bool Moving=false;  // camera moved since the last frame
+bool Coarse=false;  // last frame was rendered at reduced detail
+int Refinement=0;   // identifies the pending refinement
+double Lod=1.0;     // resolution factor for frames rendered during motion
+double Frametime=0.0; // ms
+const double minLod=1.0/64.0;
+const int refineDelay=250; // ms
+
 int x0,y0;
 string Action;
 int MenuButton;
@@ -128,6 +137,7 @@ static const double radians=1.0/degrees;
 
 double Background[4];
 size_t Nlights;
+size_t Ntriangles;
 triple *Lights; 
 double *Diffuse;
 double *Ambient;
@@ -173,6 +183,40 @@ void wait(pthread_cond_t& signal, pthread_mutex_t& lock)
 }
 #endif
 
+GLenum nurbsType;
+size_t nurbsVertices;
+
+void nurbsBegin(GLenum type)
+{
+  nurbsType=type;
+  nurbsVertices=0;
+  glBegin(type);
+}
+
+void nurbsVertex(GLfloat *v)
+{
+  ++nurbsVertices;
+  glVertex3fv(v);
+}
+
+void nurbsEnd()
+{
+  glEnd();
+  switch(nurbsType) {
+    case GL_TRIANGLES:
+      Ntriangles += nurbsVertices/3;
+      break;
+    case GL_TRIANGLE_STRIP:
+    case GL_TRIANGLE_FAN:
+    case GL_QUAD_STRIP:
+      if(nurbsVertices > 2) Ntriangles += nurbsVertices-2;
+      break;
+    case GL_QUADS:
+      Ntriangles += nurbsVertices/2;
+      break;
+  }
+}
+
 template<class T>
 inline T min(T a, T b)
 {
@@ -286,7 +330,8 @@ void setProjection()
 #endif
 }
 
-void drawscene(double Width, double Height)
+// Render the scene, reducing the adaptive resolution by the factor lod.
+void drawscene(double Width, double Height, double lod=1.0)
 {
 #ifdef HAVE_PTHREAD
   static bool first=true;
@@ -306,7 +351,11 @@ void drawscene(double Width, double Height)
   triple M(xmax,ymax,zmax);
   double perspective=orthographic ? 0.0 : 1.0/zmax;
   
-  double size2=hypot(Width,Height);
+  double size2=lod*hypot(Width,Height);
+  // With GLU_PARAMETRIC_ERROR sampling, only the parametric tolerance
+  // controls the NURBS tessellation.
+  gluNurbsProperty(nurb,GLU_PARAMETRIC_TOLERANCE,1.0/lod);
+  Ntriangles=0;
   
   // Render opaque objects
   Picture->render(nurb,size2,m,M,perspective,Nlights,false);
@@ -317,6 +366,9 @@ void drawscene(double Width, double Height)
   // Render transparent objects
   Picture->render(nurb,size2,m,M,perspective,Nlights,true);
   glDepthMask(GL_TRUE);
+
+  if(lod != 1.0)
+    gluNurbsProperty(nurb,GLU_PARAMETRIC_TOLERANCE,1.0);
 }
 
 // Return x divided by y rounded up to the nearest integer.
@@ -621,14 +673,44 @@ void nextframe(int)
   if(Step) Animate=false;
 }
 
+void refine(int n)
+{
+  if(n == Refinement && Coarse && !Moving) {
+    Coarse=false;
+    glutPostRedisplay();
+  }
+}
+
+// Record that the camera moved.
+void moved()
+{
+  Moving=getSetting<double>("framebudget") > 0.0;
+}
+
 void display()
 {
   if(queueScreen) {
     if(!Animate) screen();
     queueScreen=false;
   }
-  drawscene(Width,Height);
+  bool coarse=Moving;
+  Moving=false;
+  timeval tv;
+  gettimeofday(&tv,NULL);
+  drawscene(Width,Height,coarse ? Lod : 1.0);
   glutSwapBuffers();
+  timeval tv2;
+  gettimeofday(&tv2,NULL);
+  Frametime=1000.0*(tv2.tv_sec-tv.tv_sec)+(tv2.tv_usec-tv.tv_usec)/1000.0;
+  Coarse=coarse;
+  if(coarse) {
+    // Adjust the level of detail to the frame budget and refine once the
+    // camera stops.
+    double budget=getSetting<double>("framebudget");
+    if(Frametime > budget) Lod=max(0.5*Lod,minLod);
+    else if(Frametime < 0.5*budget) Lod=min(2.0*Lod,1.0);
+    glutTimerFunc(refineDelay,refine,++Refinement);
+  }
 #ifdef HAVE_PTHREAD
   if(glthread && Animate) {
     queueExport=false;
@@ -717,6 +799,7 @@ void shift(int x, int y)
     X += (x-x0)*Zoominv;
     Y += (y0-y)*Zoominv;
     x0=x; y0=y;
+    moved();
     update();
   }
 }
@@ -733,6 +816,7 @@ void pan(int x, int y)
       cy += (y0-y)*(ymax-ymin)/Height;
     }
     x0=x; y0=y;
+    moved();
     update();
   }
 }
@@ -780,6 +864,7 @@ void zoom(int x, int y)
         capzoom();
         lastzoom=Zoom;
         y0=y;
+        moved();
         setProjection();
         glutPostRedisplay();
       }
@@ -797,6 +882,7 @@ void mousewheel(int wheel, int direction, int x, int y)
       Zoom /= zoomFactor;
     capzoom();
     lastzoom=Zoom;
+    moved();
     setProjection();
     glutPostRedisplay();
   }
@@ -822,6 +908,7 @@ void rotate(int x, int y)
         Rotate[i4+j]=roti[j];
     }
     
+    moved();
     update();
   }
 }
@@ -839,6 +926,7 @@ void updateArcball()
     for(int j=0; j < 4; ++j)
       roti[j]=Rotate[i4+j];
   }
+  moved();
   update();
 }
 
@@ -1102,6 +1190,10 @@ void showCamera()
   if(!orthographic)
     cout << "," << endl << "autoadjust=false";
   cout << ");" << endl;
+  cout << "// " << Frametime << " ms, " << Ntriangles << " triangles";
+  if(Coarse)
+    cout << " (detail " << Lod << ")";
+  cout << endl;
 }
 
 void keyboard(unsigned char key, int x, int y)
@@ -1624,9 +1716,9 @@ void glrender(const string& prefix, const picture *pic, const string& format,
     // The callback tessellation algorithm avoids artifacts at degenerate
     // control points.
     gluNurbsProperty(nurb,GLU_NURBS_MODE,GLU_NURBS_TESSELLATOR);
-    gluNurbsCallback(nurb,GLU_NURBS_BEGIN,(_GLUfuncptr) glBegin);
-    gluNurbsCallback(nurb,GLU_NURBS_VERTEX,(_GLUfuncptr) glVertex3fv);
-    gluNurbsCallback(nurb,GLU_NURBS_END,(_GLUfuncptr) glEnd);
+    gluNurbsCallback(nurb,GLU_NURBS_BEGIN,(_GLUfuncptr) nurbsBegin);
+    gluNurbsCallback(nurb,GLU_NURBS_VERTEX,(_GLUfuncptr) nurbsVertex);
+    gluNurbsCallback(nurb,GLU_NURBS_END,(_GLUfuncptr) nurbsEnd);
     gluNurbsCallback(nurb,GLU_NURBS_COLOR,(_GLUfuncptr) glColor4fv);
   }
   
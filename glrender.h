@@ -90,6 +90,8 @@ public:
 
 projection camera(bool user=true);
 
+extern size_t Ntriangles; // Number of triangles rendered in the current frame
+
 void glrender(const string& prefix, const camp::picture* pic,
               const string& format, double width, double height, double angle,
               double zoom, const camp::triple& m, const camp::triple& M,
@@ -0,0 +1,305 @@
+/*****
+ * linalg.cc
+ *
+ * Blocked, multithreaded dense linear algebra on real matrices stored by
+ * rows, used by the matrix builtins.
+ *****/
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "linalg.h"
+#include "util.h"
+#include "vm.h"
+
+namespace run {
+
+using std::min;
+
+static const char *singular="Singular matrix";
+
+// The register block of the product kernel.
+const size_t rowstep=4;
+const size_t colstep=8;
+
+// The cache blocks of the product and of the LU decomposition.
+const size_t colblock=256;
+const size_t innerblock=128;
+const size_t LUblock=64;
+
+// The smallest number of multiplications worth doing on a thread.
+const size_t linalggrain=1 << 21;
+
+// Add s times the rowstep x inner matrix A times the inner x colstep
+// matrix B to the rowstep x colstep matrix C, for the inner indices in
+// [k0,k1). The terms are accumulated in registers, in order, so that the
+// inner loops vectorize.
+static inline void kernel(double s, const double *A, size_t lda,
+                          const double *B, size_t ldb, double *C, size_t ldc,
+                          size_t k0, size_t k1)
+{
+  double c[rowstep][colstep];
+  for(size_t r=0; r < rowstep; ++r)
+    for(size_t j=0; j < colstep; ++j)
+      c[r][j]=C[r*ldc+j];
+  for(size_t k=k0; k < k1; ++k) {
+    const double *Bk=B+k*ldb;
+    double b[colstep];
+    for(size_t j=0; j < colstep; ++j)
+      b[j]=Bk[j];
+    for(size_t r=0; r < rowstep; ++r) {
+      double a=s*A[r*lda+k];
+      for(size_t j=0; j < colstep; ++j)
+        c[r][j] += a*b[j];
+    }
+  }
+  for(size_t r=0; r < rowstep; ++r)
+    for(size_t j=0; j < colstep; ++j)
+      C[r*ldc+j]=c[r][j];
+}
+
+// The same as kernel, for blocks of any size.
+static void edge(size_t rows, size_t cols, double s,
+                 const double *A, size_t lda, const double *B, size_t ldb,
+                 double *C, size_t ldc, size_t k0, size_t k1)
+{
+  for(size_t r=0; r < rows; ++r) {
+    const double *Ar=A+r*lda;
+    double *Cr=C+r*ldc;
+    for(size_t k=k0; k < k1; ++k) {
+      double a=s*Ar[k];
+      const double *Bk=B+k*ldb;
+      for(size_t j=0; j < cols; ++j)
+        Cr[j] += a*Bk[j];
+    }
+  }
+}
+
+// Add s times the rows x inner matrix A times the inner x cols matrix B to
+// the rows x cols matrix C, where consecutive rows of each matrix are
+// separated by lda, ldb, and ldc. The terms are added to each entry of C
+// in order of their inner index.
+static void update(size_t rows, size_t cols, size_t inner, double s,
+                   const double *A, size_t lda, const double *B, size_t ldb,
+                   double *C, size_t ldc)
+{
+  size_t rows0=rows-rows % rowstep;
+  for(size_t j0=0; j0 < cols; j0 += colblock) {
+    size_t j1=min(j0+colblock,cols);
+    size_t j2=j1-(j1-j0) % colstep;
+    for(size_t k0=0; k0 < inner; k0 += innerblock) {
+      size_t k1=min(k0+innerblock,inner);
+      for(size_t i=0; i < rows0; i += rowstep) {
+        const double *Ai=A+i*lda;
+        double *Ci=C+i*ldc;
+        for(size_t j=j0; j < j2; j += colstep)
+          kernel(s,Ai,lda,B+j,ldb,Ci+j,ldc,k0,k1);
+        if(j2 < j1)
+          edge(rowstep,j1-j2,s,Ai,lda,B+j2,ldb,Ci+j2,ldc,k0,k1);
+      }
+      if(rows0 < rows)
+        edge(rows-rows0,j1-j0,s,A+rows0*lda,lda,B+j0,ldb,C+rows0*ldc+j0,ldc,
+             k0,k1);
+    }
+  }
+}
+
+struct product {
+  size_t rows,cols,inner;
+  double s;
+  const double *A;
+  size_t lda;
+  const double *B;
+  size_t ldb;
+  double *C;
+  size_t ldc;
+  size_t threads;
+
+  size_t start(size_t t) {
+    return t == threads ? rows : rows*t/threads/rowstep*rowstep;
+  }
+
+  // Update the t-th panel of rows of C.
+  static void panel(void *arg, size_t t) {
+    product *P=(product *) arg;
+    size_t i0=P->start(t);
+    size_t i1=P->start(t+1);
+    update(i1-i0,P->cols,P->inner,P->s,P->A+i0*P->lda,P->lda,P->B,P->ldb,
+           P->C+i0*P->ldc,P->ldc);
+  }
+};
+
+// The same as update, splitting the rows of C into panels updated on
+// separate threads.
+static void parallelUpdate(size_t rows, size_t cols, size_t inner, double s,
+                           const double *A, size_t lda,
+                           const double *B, size_t ldb,
+                           double *C, size_t ldc)
+{
+  size_t threads=min(threadcount(rows*cols*inner,linalggrain),
+                     std::max(rows/rowstep,(size_t) 1));
+  if(threads == 1) {
+    update(rows,cols,inner,s,A,lda,B,ldb,C,ldc);
+    return;
+  }
+  product P={rows,cols,inner,s,A,lda,B,ldb,C,ldc,threads};
+  parallel(threads,product::panel,&P);
+}
+
+void multiply(double *C, const double *A, const double *B,
+              size_t n, size_t l, size_t m)
+{
+  std::fill(C,C+n*m,0.0);
+  parallelUpdate(n,m,l,1.0,A,l,B,m,C,m);
+}
+
+// This computes the same factors, with the same pivots and the same
+// rounding, as Crout's algorithm (cf. routine ludcmp, Press et al.,
+// Numerical Recipes, 1991), but it factors a panel of LUblock columns at a
+// time and then updates the trailing submatrix with a threaded product.
+Int LUdecompose(double *a, size_t n, size_t *index, bool warn)
+{
+  std::vector<double> vv(n);
+  for(size_t i=0; i < n; ++i) {
+    double big=0.0;
+    double *ai=a+i*n;
+    for(size_t j=0; j < n; ++j) {
+      double temp=fabs(ai[j]);
+      if(temp > big) big=temp;
+    }
+    if(big == 0.0) {
+      if(warn) vm::error(singular);
+      return 0;
+    }
+    vv[i]=1.0/big;
+  }
+
+  Int swap=1;
+  for(size_t j0=0; j0 < n; j0 += LUblock) {
+    size_t j1=min(j0+LUblock,n);
+
+    // Factor the columns [j0,j1).
+    for(size_t j=j0; j < j1; ++j) {
+      double big=0.0;
+      size_t imax=j;
+      for(size_t i=j; i < n; ++i) {
+        double temp=vv[i]*fabs(a[i*n+j]);
+        if(temp >= big) {
+          big=temp;
+          imax=i;
+        }
+      }
+      double *aj=a+j*n;
+      if(j != imax) {
+        std::swap_ranges(aj,aj+n,a+imax*n);
+        swap *= -1;
+        vv[imax]=vv[j];
+      }
+      if(index)
+        index[j]=imax;
+      double denom=aj[j];
+      if(denom == 0.0) {
+        if(warn) vm::error(singular);
+        return 0;
+      }
+      for(size_t i=j+1; i < n; ++i) {
+        double *ai=a+i*n;
+        double l=ai[j] /= denom;
+        for(size_t k=j+1; k < j1; ++k)
+          ai[k] -= l*aj[k];
+      }
+    }
+
+    if(j1 < n) {
+      // Compute rows [j0,j1) of U to the right of the panel.
+      double *U=a+j0*n+j1;
+      for(size_t i=j0+1; i < j1; ++i)
+        update(1,n-j1,i-j0,-1.0,a+i*n+j0,n,U,n,a+i*n+j1,n);
+
+      // Update the trailing submatrix.
+      parallelUpdate(n-j1,n-j1,j1-j0,-1.0,a+j1*n+j0,n,U,n,a+j1*n+j1,n);
+    }
+  }
+  return swap;
+}
+
+// Overwrite the n x m matrix B, with rows separated by ldb, with the
+// solution of LUx=B.
+static void substitute(double *B, size_t ldb, size_t m, const double *A,
+                       size_t n)
+{
+  for(size_t i0=0; i0 < n; i0 += LUblock) {
+    size_t i1=min(i0+LUblock,n);
+    update(i1-i0,m,i0,-1.0,A+i0*n,n,B,ldb,B+i0*ldb,ldb);
+    for(size_t i=i0+1; i < i1; ++i)
+      update(1,m,i-i0,-1.0,A+i*n+i0,n,B+i0*ldb,ldb,B+i*ldb,ldb);
+  }
+
+  for(size_t i1=n; i1 > 0;) {
+    size_t i0=i1 > LUblock ? i1-LUblock : 0;
+    update(i1-i0,m,n-i1,-1.0,A+i0*n+i1,n,B+i1*ldb,ldb,B+i0*ldb,ldb);
+    for(size_t i=i1; i > i0;) {
+      --i;
+      const double *Ai=A+i*n;
+      double *Bi=B+i*ldb;
+      update(1,m,i1-i-1,-1.0,Ai+i+1,n,Bi+ldb,ldb,Bi,ldb);
+      double denom=Ai[i];
+      for(size_t k=0; k < m; ++k)
+        Bi[k] /= denom;
+    }
+    i1=i0;
+  }
+}
+
+struct substitution {
+  double *B;
+  const double *A;
+  size_t n,m;
+  size_t threads;
+
+  size_t start(size_t t) {
+    return t == threads ? m : m*t/threads/colstep*colstep;
+  }
+
+  // Solve for the t-th panel of columns of B.
+  static void panel(void *arg, size_t t) {
+    substitution *S=(substitution *) arg;
+    size_t j0=S->start(t);
+    size_t j1=S->start(t+1);
+    substitute(S->B+j0,S->m,j1-j0,S->A,S->n);
+  }
+};
+
+void LUsolve(double *B, const double *A, const size_t *index,
+             size_t n, size_t m)
+{
+  for(size_t i=0; i < n; ++i) {
+    size_t ip=index[i];
+    if(ip != i)
+      std::swap_ranges(B+i*m,B+(i+1)*m,B+ip*m);
+  }
+
+  size_t threads=min(threadcount(n*n*m,linalggrain),
+                     std::max(m/colstep,(size_t) 1));
+  if(threads == 1) {
+    substitute(B,m,m,A,n);
+    return;
+  }
+  substitution S={B,A,n,m,threads};
+  parallel(threads,substitution::panel,&S);
+}
+
+void inverse(double *a, size_t n)
+{
+  if(n == 0) return;
+  std::vector<size_t> index(n);
+  LUdecompose(a,n,&index[0]);
+  std::vector<double> B(n*n,0.0);
+  for(size_t i=0; i < n; ++i)
+    B[i*(n+1)]=1.0;
+  LUsolve(&B[0],a,&index[0],n,n);
+  std::copy(B.begin(),B.end(),a);
+}
+
+} // namespace run
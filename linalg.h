@@ -0,0 +1,36 @@
+/*****
+ * linalg.h
+ *
+ * Blocked, multithreaded dense linear algebra on real matrices stored by
+ * rows, used by the matrix builtins.
+ *****/
+#ifndef LINALG_H
+#define LINALG_H
+
+#include "common.h"
+
+namespace run {
+
+// Set the n x m matrix C to the product of the n x l matrix A and the
+// l x m matrix B.
+void multiply(double *C, const double *A, const double *B,
+              size_t n, size_t l, size_t m);
+
+// Compute the LU decomposition of the n x n matrix a in place by Gaussian
+// elimination with implicitly scaled partial pivoting, storing the pivot
+// row of each column in index (if it is not NULL). Return 1 or -1 according
+// to whether the number of row interchanges is even or odd. If a is
+// singular, report an error if warn is true; otherwise return 0.
+Int LUdecompose(double *a, size_t n, size_t *index, bool warn=true);
+
+// Overwrite the n x m matrix B with the solution x of ax=B, given the
+// LU decomposition A and pivots index of a.
+void LUsolve(double *B, const double *A, const size_t *index,
+             size_t n, size_t m);
+
+// Invert an n x n matrix in place.
+void inverse(double *a, size_t n);
+
+} // namespace run
+
+#endif
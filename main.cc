@@ -37,6 +37,7 @@
 #include "locate.h"
 #include "interact.h"
 #include "process.h"
+#include "picture.h"
 
 #include "stack.h"
 
@@ -146,6 +147,12 @@ void *asymain(void *A)
   vm::dumpProfile();
 #endif
 
+  try {
+    camp::shipoutwait();
+  } catch(handled_error) {
+    em.statusError();
+  }
+
   if(getSetting<bool>("wait")) {
     int status;
     while(wait(&status) > 0);
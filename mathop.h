@@ -89,6 +89,7 @@ struct timesR {
 
 extern void dividebyzero(size_t i=0);  
 extern void integeroverflow(size_t i=0);  
+extern void uninitialized(size_t i=0);
   
 template <typename T>
 struct divide {
@@ -0,0 +1,176 @@
+/*****
+ * numformat.cc
+ *
+ * Fast output of floating-point numbers in the stream formats used for
+ * PostScript, PDF, and SVG coordinates.
+ *****/
+
+#include <cmath>
+#include <cstring>
+
+#include "numformat.h"
+
+namespace camp {
+
+typedef unsigned long long ullong;
+
+// Powers of ten that are exactly representable as doubles.
+static const double dpow10[]={
+  1e0,1e1,1e2,1e3,1e4,1e5,1e6,1e7,1e8,1e9,1e10,1e11,
+  1e12,1e13,1e14,1e15,1e16,1e17,1e18,1e19,1e20,1e21,1e22
+};
+
+static const int maxpow10=22;
+
+static const ullong ipow10[]={
+  1ULL,10ULL,100ULL,1000ULL,10000ULL,100000ULL,1000000ULL,10000000ULL,
+  100000000ULL,1000000000ULL,10000000000ULL,100000000000ULL,
+  1000000000000ULL,10000000000000ULL,100000000000000ULL,
+  1000000000000000ULL,10000000000000000ULL
+};
+
+// The largest precision for which results are computed directly.
+static const int maxprecision=15;
+
+// Return x*10^k, correctly rounded.
+static inline double scale10(double x, int k)
+{
+  return k >= 0 ? x*dpow10[k] : x/dpow10[-k];
+}
+
+// Round y, which approximates the exact value x*10^k to within half a unit
+// in the last place, to the nearest integer m. Return false if y is so close
+// to a half-integer that the rounding of the exact value is uncertain.
+static inline bool roundexact(double y, ullong& m)
+{
+  if(!(y < 4.5e15)) return false;
+  double f=floor(y);
+  double r=y-f;
+  if(fabs(r-0.5) <= y*2.3e-16) return false;
+  m=(ullong) f+(r > 0.5);
+  return true;
+}
+
+// Write the n decimal digits of m, including leading zeros, to s.
+static inline char *digits(char *s, ullong m, int n)
+{
+  for(int i=n-1; i >= 0; --i) {
+    s[i]='0'+(char) (m % 10);
+    m /= 10;
+  }
+  return s+n;
+}
+
+// Return the number of decimal digits of m > 0.
+static inline int ndigits(ullong m)
+{
+  int n=1;
+  while(n < 17 && m >= ipow10[n]) ++n;
+  return n;
+}
+
+size_t formatnumber(char *s, double x, int precision, bool fixed)
+{
+  if(!std::isfinite(x) || precision < 0 || precision > maxprecision)
+    return 0;
+
+  char *p=s;
+  if(std::signbit(x)) {
+    *(p++)='-';
+    x=-x;
+  }
+
+  ullong m;
+  if(fixed) {
+    if(!roundexact(scale10(x,precision),m)) return 0;
+    ullong i=m/ipow10[precision];
+    p=digits(p,i,i > 0 ? ndigits(i) : 1);
+    if(precision > 0) {
+      *(p++)='.';
+      p=digits(p,m % ipow10[precision],precision);
+    }
+    return p-s;
+  }
+
+  if(x == 0.0) {
+    *(p++)='0';
+    return p-s;
+  }
+
+  // Find the decimal exponent e of x rounded to P significant digits.
+  int P=precision == 0 ? 1 : precision;
+  int e=(int) floor(log10(x));
+  for(int i=0;; ++i) {
+    int k=P-1-e;
+    if(i == 3 || k > maxpow10 || k < -maxpow10) return 0;
+    if(!roundexact(scale10(x,k),m)) return 0;
+    if(m >= ipow10[P]) ++e;
+    else if(m < ipow10[P-1]) --e;
+    else break;
+  }
+
+  // Drop trailing zeros.
+  int n=P;
+  while(n > 1 && m % 10 == 0) {
+    m /= 10;
+    --n;
+  }
+
+  char d[maxprecision];
+  digits(d,m,n);
+
+  if(e < -4 || e >= P) {
+    *(p++)=d[0];
+    if(n > 1) {
+      *(p++)='.';
+      memcpy(p,d+1,n-1);
+      p += n-1;
+    }
+    *(p++)='e';
+    *(p++)=e < 0 ? '-' : '+';
+    if(e < 0) e=-e;
+    p=digits(p,e,e >= 100 ? 3 : 2);
+  } else if(e >= 0) {
+    int integer=e+1;
+    if(n <= integer) {
+      memcpy(p,d,n);
+      p += n;
+      for(int i=n; i < integer; ++i)
+        *(p++)='0';
+    } else {
+      memcpy(p,d,integer);
+      p += integer;
+      *(p++)='.';
+      memcpy(p,d+integer,n-integer);
+      p += n-integer;
+    }
+  } else {
+    *(p++)='0';
+    *(p++)='.';
+    for(int i=-1; i > e; --i)
+      *(p++)='0';
+    memcpy(p,d,n);
+    p += n;
+  }
+  return p-s;
+}
+
+void writenumber(std::ostream& out, double x)
+{
+  std::ios_base::fmtflags flags=out.flags();
+  std::ios_base::fmtflags floatfield=flags & std::ios_base::floatfield;
+  bool fixed=floatfield == std::ios_base::fixed;
+  if((fixed || floatfield == 0) && out.width() == 0 &&
+     !(flags & (std::ios_base::showpos | std::ios_base::showpoint |
+                std::ios_base::uppercase))) {
+    char s[maxnumberlength];
+    size_t n=formatnumber(s,x,(int) out.precision(),fixed);
+    if(n > 0) {
+      out.write(s,n);
+      return;
+    }
+  }
+  out << x;
+}
+
+} //namespace camp
@@ -0,0 +1,30 @@
+/*****
+ * numformat.h
+ *
+ * Fast output of floating-point numbers in the stream formats used for
+ * PostScript, PDF, and SVG coordinates.
+ *****/
+
+#ifndef NUMFORMAT_H
+#define NUMFORMAT_H
+
+#include <iostream>
+
+namespace camp {
+
+// Maximum number of characters written by formatnumber.
+const size_t maxnumberlength=32;
+
+// Format x into s as printf would with the format %.<precision>g or,
+// if fixed, %.<precision>f, returning the number of characters written.
+// Returns 0 if the result cannot be determined quickly, in which case the
+// caller should fall back to a general-purpose conversion.
+size_t formatnumber(char *s, double x, int precision, bool fixed);
+
+// Write x to out exactly as out << x would, given the precision and
+// floatfield of out, but without going through the stream's numeric facets.
+void writenumber(std::ostream& out, double x);
+
+} //namespace camp
+
+#endif
@@ -0,0 +1,690 @@
+/*****
+ * outline.cc
+ *
+ * Construction of glyph outlines for texpath.
+ *****/
+
+#include <cctype>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+
+#include "outline.h"
+#include "settings.h"
+#include "pipestream.h"
+#include "util.h"
+
+#ifdef HAVE_LIBFREETYPE
+#include <ft2build.h>
+#include FT_FREETYPE_H
+#include FT_OUTLINE_H
+#endif
+
+namespace camp {
+
+void pathbuilder::moveto(pair z)
+{
+  if(active) {
+    if(cyclic) {
+      if(node.point == nodes[0].point)
+        nodes[0].pre=node.pre;
+      else {
+        pair delta=(nodes[0].point-node.point)*third;
+        node.post=node.point+delta;
+        nodes[0].pre=nodes[0].point-delta;
+        node.straight=true;
+        nodes.push_back(node);
+      }
+    } else {
+      node.post=node.point;
+      node.straight=false;
+      nodes.push_back(node);
+    }
+    if(cyclic) // Discard noncyclic paths.
+      P->push(path(nodes,nodes.size(),cyclic));
+    nodes.clear();
+  }
+  active=false;
+  cyclic=false;
+  node.pre=node.point=z;
+  node.straight=false;
+}
+
+void pathbuilder::lineto(pair z)
+{
+  pair delta=(z-node.point)*third;
+  node.post=node.point+delta;
+  node.straight=true;
+  nodes.push_back(node);
+  active=true;
+  node.pre=z-delta;
+  node.point=z;
+}
+
+void pathbuilder::curveto(pair zp, pair zm, pair z1)
+{
+  node.post=zp;
+  node.straight=false;
+  nodes.push_back(node);
+  active=true;
+  node.pre=zm;
+  node.point=z1;
+}
+
+#ifdef HAVE_LIBFREETYPE
+
+using settings::verbose;
+
+// A glyph outline in font units, as a sequence of path construction
+// commands M, L, C, and c (closepath).
+struct glyph {
+  struct segment {
+    char type;
+    pair z[3];
+  };
+  mem::vector<segment> segments;
+  bool valid;
+
+  glyph() : valid(false) {}
+
+  void add(char type, pair z0=pair(), pair z1=pair(), pair z2=pair()) {
+    segment s;
+    s.type=type;
+    s.z[0]=z0;
+    s.z[1]=z1;
+    s.z[2]=z2;
+    segments.push_back(s);
+  }
+};
+
+// A font file loaded by FreeType, with the outlines of its glyphs.
+struct face : public gc {
+  FT_Face ft;
+  mem::map<FT_UInt,glyph> glyphs;
+};
+
+// An entry of the dvips font map.
+struct fontmapentry {
+  string fontfile;
+  string encoding;
+  double extend;
+  double slant;
+  fontmapentry() : extend(1.0), slant(0.0) {}
+};
+
+// The character widths of a TeX font metric file, as fractions of the
+// design size.
+struct metrics {
+  Int bc;
+  mem::vector<double> widths;
+};
+
+// A font defined in a DVI file.
+struct dvifont {
+  face *f;
+  const metrics *tfm;
+  const mem::vector<string> *encoding;
+  double size;      // scaled size in DVI units
+  double extend;
+  double slant;
+};
+
+typedef mem::map<CONST string,string> filemap;
+typedef mem::map<CONST string,fontmapentry> fontmap;
+typedef mem::map<CONST string,face *> facemap;
+typedef mem::map<CONST string,metrics> metricsmap;
+typedef mem::map<CONST string,mem::vector<string> > encodingmap;
+
+// Return the full name of a file in the TeX distribution, or the empty
+// string if it cannot be found.
+static string kpsefind(const string& name)
+{
+  static filemap found;
+  filemap::iterator p=found.find(name);
+  if(p != found.end()) return p->second;
+
+  mem::vector<string> cmd;
+  string kpsewhich="kpsewhich";
+  string fullname=stripFile(settings::argv0)+kpsewhich;
+  std::ifstream exists(fullname.c_str());
+  if(!exists) fullname=kpsewhich;
+  cmd.push_back(fullname);
+  cmd.push_back(name);
+  string s;
+  iopipestream pipe(cmd);
+  pipe >> s;
+  size_t n=s.find_first_of("\r\n");
+  if(n != string::npos)
+    s.erase(n);
+  found[name]=s;
+  return s;
+}
+
+static string readfile(const string& name)
+{
+  std::ifstream fin(name.c_str(),std::ios::binary);
+  if(!fin) return "";
+  ostringstream buf;
+  buf << fin.rdbuf();
+  return buf.str();
+}
+
+static const fontmap& psfontmap()
+{
+  static fontmap Map;
+  static bool loaded=false;
+  if(loaded) return Map;
+  loaded=true;
+
+  std::ifstream fin(kpsefind("psfonts.map").c_str());
+  string line;
+  while(getline(fin,line)) {
+    if(line.empty() || strchr("%#*;",line[0])) continue;
+    string tfm,special;
+    fontmapentry entry;
+    size_t i=0, n=line.size();
+    while(i < n) {
+      while(i < n && isspace(line[i])) ++i;
+      if(i == n) break;
+      size_t j;
+      if(line[i] == '"') {
+        j=line.find('"',i+1);
+        if(j == string::npos) j=n;
+        special=line.substr(i+1,j-i-1);
+        i=j+1;
+        continue;
+      }
+      for(j=i; j < n && !isspace(line[j]); ++j) ;
+      string token=line.substr(i,j-i);
+      i=j;
+      if(token[0] == '<') {
+        size_t k=token.find_first_not_of("<[");
+        if(k == string::npos) {
+          // The file name follows a separated < or <[.
+          while(i < n && isspace(line[i])) ++i;
+          for(j=i; j < n && !isspace(line[j]); ++j) ;
+          token=line.substr(i,j-i);
+          i=j;
+        } else token.erase(0,k);
+        size_t length=token.size();
+        if(length > 4 && token.substr(length-4) == ".enc")
+          entry.encoding=token;
+        else entry.fontfile=token;
+      } else if(tfm.empty()) tfm=token;
+    }
+
+    istringstream s(special);
+    string previous,token;
+    while(s >> token) {
+      if(token == "ExtendFont") entry.extend=atof(previous.c_str());
+      else if(token == "SlantFont") entry.slant=atof(previous.c_str());
+      previous=token;
+    }
+    if(!tfm.empty() && Map.find(tfm) == Map.end())
+      Map[tfm]=entry;
+  }
+  return Map;
+}
+
+static inline Int bytes(const string& s, size_t i, size_t n)
+{
+  Int value=0;
+  for(size_t k=0; k < n; ++k)
+    value=(value << 8) | (unsigned char) s[i+k];
+  return value;
+}
+
+static const metrics *tfmmetrics(const string& name)
+{
+  static metricsmap loaded;
+  metricsmap::iterator p=loaded.find(name);
+  if(p != loaded.end()) return p->second.bc >= 0 ? &p->second : NULL;
+
+  metrics& m=loaded[name];
+  m.bc=-1;
+  string d=readfile(kpsefind(name+".tfm"));
+  if(d.size() < 24) return NULL;
+  Int lf=bytes(d,0,2), lh=bytes(d,2,2), bc=bytes(d,4,2), ec=bytes(d,6,2);
+  Int nw=bytes(d,8,2);
+  if((size_t) (4*lf) > d.size() || ec < bc-1) return NULL;
+  size_t charinfo=24+4*lh;
+  size_t widthbase=charinfo+4*(ec-bc+1);
+  if(widthbase+4*nw > d.size()) return NULL;
+  for(Int c=bc; c <= ec; ++c) {
+    Int w=bytes(d,charinfo+4*(c-bc),1);
+    if(w >= nw) return NULL;
+    int fix=(int) bytes(d,widthbase+4*w,4);
+    m.widths.push_back(fix/1048576.0);
+  }
+  m.bc=bc;
+  return &m;
+}
+
+static const mem::vector<string> *encoding(const string& name)
+{
+  static encodingmap loaded;
+  encodingmap::iterator p=loaded.find(name);
+  if(p != loaded.end()) return p->second.size() ? &p->second : NULL;
+
+  mem::vector<string>& e=loaded[name];
+  std::ifstream fin(kpsefind(name).c_str());
+  string line;
+  bool vector=false;
+  while(getline(fin,line)) {
+    size_t n=line.find('%');
+    if(n != string::npos) line.erase(n);
+    for(size_t i=0; i < line.size();) {
+      char c=line[i];
+      if(c == '[') {vector=true; ++i; continue;}
+      if(c == ']') {vector=false; ++i; continue;}
+      if(c == '/' && vector) {
+        size_t j=line.find_first_of(" \t\r/[]",i+1);
+        if(j == string::npos) j=line.size();
+        e.push_back(line.substr(i+1,j-i-1));
+        i=j;
+        continue;
+      }
+      ++i;
+    }
+  }
+  if(e.size() != 256) {
+    e.clear();
+    return NULL;
+  }
+  return &e;
+}
+
+static int ftmoveto(const FT_Vector *to, void *user)
+{
+  glyph *g=(glyph *) user;
+  if(!g->segments.empty()) g->add('c');
+  g->add('M',pair(to->x,to->y));
+  return 0;
+}
+
+static int ftlineto(const FT_Vector *to, void *user)
+{
+  ((glyph *) user)->add('L',pair(to->x,to->y));
+  return 0;
+}
+
+static pair lastpoint(const glyph *g)
+{
+  const glyph::segment& s=g->segments.back();
+  return s.z[s.type == 'C' ? 2 : 0];
+}
+
+static int ftconicto(const FT_Vector *control, const FT_Vector *to, void *user)
+{
+  glyph *g=(glyph *) user;
+  pair z0=lastpoint(g);
+  pair c(control->x,control->y);
+  pair z1(to->x,to->y);
+  g->add('C',z0+2.0*third*(c-z0),z1+2.0*third*(c-z1),z1);
+  return 0;
+}
+
+static int ftcubicto(const FT_Vector *control1, const FT_Vector *control2,
+                   const FT_Vector *to, void *user)
+{
+  ((glyph *) user)->add('C',pair(control1->x,control1->y),
+                        pair(control2->x,control2->y),pair(to->x,to->y));
+  return 0;
+}
+
+class freetypeoutliner : public outlineprovider {
+  FT_Library library;
+  bool initialized;
+  facemap faces;
+
+  face *loadface(const string& name);
+  const glyph *outline(face *f, FT_UInt index);
+  bool unsupported(const string& reason);
+
+public:
+  freetypeoutliner() : initialized(FT_Init_FreeType(&library) == 0) {}
+
+  bool dvi(const string& dviname, vm::array *PP);
+};
+
+face *freetypeoutliner::loadface(const string& name)
+{
+  facemap::iterator p=faces.find(name);
+  if(p != faces.end()) return p->second;
+
+  face *f=NULL;
+  FT_Face ft;
+  if(!name.empty() && FT_New_Face(library,name.c_str(),0,&ft) == 0) {
+    if(FT_IS_SCALABLE(ft)) {
+      // Use the built-in encoding of Type 1 fonts.
+      if(FT_Select_Charmap(ft,FT_ENCODING_ADOBE_CUSTOM) != 0)
+        FT_Select_Charmap(ft,FT_ENCODING_ADOBE_STANDARD);
+      f=new face;
+      f->ft=ft;
+    } else FT_Done_Face(ft);
+  }
+  faces[name]=f;
+  return f;
+}
+
+const glyph *freetypeoutliner::outline(face *f, FT_UInt index)
+{
+  glyph& g=f->glyphs[index];
+  if(g.valid || !g.segments.empty()) return g.valid ? &g : NULL;
+
+  if(FT_Load_Glyph(f->ft,index,FT_LOAD_NO_SCALE | FT_LOAD_NO_HINTING |
+                   FT_LOAD_NO_BITMAP) != 0 ||
+     f->ft->glyph->format != FT_GLYPH_FORMAT_OUTLINE) {
+    g.add('c');
+    return NULL;
+  }
+
+  FT_Outline_Funcs funcs;
+  funcs.move_to=ftmoveto;
+  funcs.line_to=ftlineto;
+  funcs.conic_to=ftconicto;
+  funcs.cubic_to=ftcubicto;
+  funcs.shift=0;
+  funcs.delta=0;
+  if(FT_Outline_Decompose(&f->ft->glyph->outline,&funcs,&g) != 0) {
+    g.segments.clear();
+    g.add('c');
+    return NULL;
+  }
+  if(!g.segments.empty()) g.add('c');
+  g.valid=true;
+  return &g;
+}
+
+bool freetypeoutliner::unsupported(const string& reason)
+{
+  if(verbose > 1)
+    cerr << "Outlining with Ghostscript: " << reason << endl;
+  return false;
+}
+
+// A cursor into the contents of a DVI file.
+class dvistream {
+  const string& data;
+  size_t pos;
+  bool Fail;
+public:
+  dvistream(const string& data) : data(data), pos(0), Fail(false) {}
+
+  bool fail() {return Fail;}
+
+  Int u(size_t n) {
+    if(pos+n > data.size()) {
+      Fail=true;
+      return 0;
+    }
+    Int value=bytes(data,pos,n);
+    pos += n;
+    return value;
+  }
+
+  Int s(size_t n) {
+    Int value=u(n);
+    if(n < 8 && (value >> (8*n-1)) & 1)
+      value -= (Int) 1 << (8*n);
+    return value;
+  }
+
+  string str(size_t n) {
+    if(pos+n > data.size()) {
+      Fail=true;
+      return "";
+    }
+    string value=data.substr(pos,n);
+    pos += n;
+    return value;
+  }
+
+  void skip(size_t n) {
+    pos += n;
+    if(pos > data.size()) Fail=true;
+  }
+};
+
+struct dviposition {
+  Int h,v,w,x,y,z;
+};
+
+bool freetypeoutliner::dvi(const string& dviname, vm::array *PP)
+{
+  if(!initialized) return unsupported("FreeType could not be initialized");
+
+  string data=readfile(dviname);
+  dvistream in(data);
+  if(in.u(1) != 247 || in.u(1) != 2)
+    return unsupported("cannot read "+dviname);
+  double num=in.u(4);
+  double den=in.u(4);
+  double mag=in.u(4);
+  in.skip(in.u(1));
+  if(in.fail() || den == 0)
+    return unsupported("cannot read "+dviname);
+
+  // The length in bp of one DVI unit.
+  double unit=num/den*mag*1.0e-10*72.0/0.0254;
+
+  const fontmap& Map=psfontmap();
+  mem::map<Int,dvifont> fonts;
+  dvifont *font=NULL;
+  mem::vector<dviposition> stack;
+  dviposition p={0,0,0,0,0,0};
+  Int h0=0, v0=0;
+  bool first=true;
+  vm::array *P=NULL;
+  pathbuilder builder(P);
+  bool page=false;
+
+  for(;;) {
+    if(in.fail()) return unsupported("cannot read "+dviname);
+    Int op=in.u(1);
+
+    Int c=-1;
+    bool move=true;
+    Int a=0, b=0;
+    bool rule=false;
+
+    if(op < 128) c=op;
+    else if(op >= 171 && op <= 234) {
+      mem::map<Int,dvifont>::iterator f=fonts.find(op-171);
+      if(f == fonts.end()) return unsupported("undefined font");
+      font=&f->second;
+      continue;
+    } else switch(op) {
+        case 128: case 129: case 130: case 131:
+          c=in.u(op-127);
+          break;
+        case 133: case 134: case 135: case 136:
+          c=in.u(op-132);
+          move=false;
+          break;
+        case 132:
+        case 137:
+          a=in.s(4);
+          b=in.s(4);
+          rule=true;
+          move=op == 132;
+          break;
+        case 138:
+          continue;
+        case 139:
+          in.skip(44);
+          p.h=p.v=p.w=p.x=p.y=p.z=0;
+          stack.clear();
+          font=NULL;
+          first=true;
+          P=new vm::array(0);
+          builder=pathbuilder(P);
+          page=true;
+          continue;
+        case 140:
+          if(!page) return unsupported("cannot read "+dviname);
+          builder.moveto(pair(0,0));
+          PP->push(P);
+          page=false;
+          continue;
+        case 141:
+          stack.push_back(p);
+          continue;
+        case 142:
+          if(stack.empty()) return unsupported("cannot read "+dviname);
+          p=stack.back();
+          stack.pop_back();
+          continue;
+        case 143: case 144: case 145: case 146:
+          p.h += in.s(op-142);
+          continue;
+        case 147: case 148: case 149: case 150: case 151:
+          if(op > 147) p.w=in.s(op-147);
+          p.h += p.w;
+          continue;
+        case 152: case 153: case 154: case 155: case 156:
+          if(op > 152) p.x=in.s(op-152);
+          p.h += p.x;
+          continue;
+        case 157: case 158: case 159: case 160:
+          p.v += in.s(op-156);
+          continue;
+        case 161: case 162: case 163: case 164: case 165:
+          if(op > 161) p.y=in.s(op-161);
+          p.v += p.y;
+          continue;
+        case 166: case 167: case 168: case 169: case 170:
+          if(op > 166) p.z=in.s(op-166);
+          p.v += p.z;
+          continue;
+        case 235: case 236: case 237: case 238:
+        {
+          mem::map<Int,dvifont>::iterator f=fonts.find(in.u(op-234));
+          if(f == fonts.end()) return unsupported("undefined font");
+          font=&f->second;
+          continue;
+        }
+        case 239: case 240: case 241: case 242:
+          // Ignore specials.
+          in.skip(in.u(op-238));
+          continue;
+        case 243: case 244: case 245: case 246:
+        {
+          Int k=in.u(op-242);
+          in.skip(4);
+          Int size=in.u(4);
+          in.skip(4);
+          Int length=in.u(1);
+          length += in.u(1);
+          string name=in.str(length);
+          if(in.fail()) return unsupported("cannot read "+dviname);
+          if(fonts.find(k) != fonts.end()) continue;
+
+          dvifont& f=fonts[k];
+          f.size=size;
+          f.f=NULL;
+          f.tfm=tfmmetrics(name);
+          f.encoding=NULL;
+          f.extend=1.0;
+          f.slant=0.0;
+          fontmap::const_iterator e=Map.find(name);
+          if(e != Map.end()) {
+            const fontmapentry& entry=e->second;
+            if(!entry.fontfile.empty())
+              f.f=loadface(kpsefind(entry.fontfile));
+            if(!entry.encoding.empty())
+              f.encoding=encoding(entry.encoding);
+            f.extend=entry.extend;
+            f.slant=entry.slant;
+          }
+          continue;
+        }
+        case 248:
+          return true;
+        default:
+          return unsupported("cannot read "+dviname);
+      }
+
+    if(in.fail() || !page) return unsupported("cannot read "+dviname);
+
+    if(first) {
+      h0=p.h;
+      v0=p.v;
+      first=false;
+    }
+    double x=(p.h-h0)*unit;
+    double y=(v0-p.v)*unit;
+
+    if(rule) {
+      if(a > 0 && b > 0) {
+        double width=b*unit;
+        double height=a*unit;
+        builder.moveto(pair(x,y));
+        builder.lineto(pair(x+width,y));
+        builder.lineto(pair(x+width,y+height));
+        builder.lineto(pair(x,y+height));
+        builder.closepath();
+      }
+      if(move) p.h += b;
+      continue;
+    }
+
+    if(!font) return unsupported("character without font");
+    if(!font->f || !font->tfm)
+      return unsupported("font without Type 1 or OpenType outlines");
+    const metrics *tfm=font->tfm;
+    if(c < tfm->bc || c >= tfm->bc+(Int) tfm->widths.size())
+      return unsupported("character not in font");
+
+    FT_Face ft=font->f->ft;
+    FT_UInt index;
+    if(font->encoding) {
+      if(c > 255) return unsupported("character not in encoding");
+      index=FT_Get_Name_Index(ft,(FT_String *) (*font->encoding)[c].c_str());
+    } else index=FT_Get_Char_Index(ft,c);
+    const glyph *g=index ? outline(font->f,index) : NULL;
+    if(!g) return unsupported("glyph not in font");
+
+    double scale=font->size*unit/ft->units_per_EM;
+    double xx=scale*font->extend;
+    double xy=scale*font->slant;
+    for(size_t i=0; i < g->segments.size(); ++i) {
+      const glyph::segment& s=g->segments[i];
+      pair z[3];
+      for(size_t j=0; j < 3; ++j) {
+        const pair& w=s.z[j];
+        z[j]=pair(x+xx*w.getx()+xy*w.gety(),y+scale*w.gety());
+      }
+      switch(s.type) {
+        case 'M':
+          builder.moveto(z[0]);
+          break;
+        case 'L':
+          builder.lineto(z[0]);
+          break;
+        case 'C':
+          builder.curveto(z[0],z[1],z[2]);
+          break;
+        case 'c':
+          builder.closepath();
+          break;
+      }
+    }
+
+    if(move)
+      p.h += (Int) floor(tfm->widths[c-tfm->bc]*font->size+0.5);
+  }
+}
+
+#endif
+
+outlineprovider *outliner()
+{
+#ifdef HAVE_LIBFREETYPE
+  static freetypeoutliner freetype;
+  if(settings::getSetting<bool>("freetype")) return &freetype;
+#endif
+  return NULL;
+}
+
+} //namespace camp
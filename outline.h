@@ -0,0 +1,52 @@
+/*****
+ * outline.h
+ *
+ * Construction of glyph outlines for texpath.
+ *****/
+
+#ifndef OUTLINE_H
+#define OUTLINE_H
+
+#include "common.h"
+#include "array.h"
+#include "path.h"
+
+namespace camp {
+
+// Assembles the nodes of paths from PostScript path construction commands,
+// appending each closed path to an array and discarding the others.
+class pathbuilder {
+  vm::array *P;
+  mem::vector<solvedKnot> nodes;
+  solvedKnot node;
+  bool cyclic;
+  bool active;
+public:
+  pathbuilder(vm::array *P) : P(P), cyclic(false), active(false) {}
+
+  // Complete the current path and begin a new one at z.
+  void moveto(pair z);
+  void lineto(pair z);
+  void curveto(pair zp, pair zm, pair z1);
+  void closepath() {cyclic=true;}
+};
+
+// An interface for converting the pages of a DVI file to glyph outlines
+// without running dvips and Ghostscript.
+class outlineprovider {
+public:
+  virtual ~outlineprovider() {}
+
+  // Append to PP an array of the paths of the glyphs and rules of each page
+  // of dviname, relative to the reference point of the first glyph or
+  // rule on the page. Return false if some page cannot be outlined.
+  virtual bool dvi(const string& dviname, vm::array *PP)=0;
+};
+
+// Return the provider used for outlining DVI files in process, or NULL if
+// outlines must be obtained from Ghostscript.
+outlineprovider *outliner();
+
+} //namespace camp
+
+#endif
@@ -0,0 +1,496 @@
+/*****
+ * pdffile.cc
+ *
+ * Writes pictures without labels directly to a PDF file.
+ *****/
+
+#include <ctime>
+
+#include "pdffile.h"
+#include "settings.h"
+#include "errormsg.h"
+
+using std::ofstream;
+using vm::array;
+using vm::read;
+
+namespace camp {
+
+void checkColorSpace(ColorSpace colorspace);
+
+static const char *inconsistent="inconsistent colorspaces";
+
+// Temporarily redirect the output of a psfile.
+class redirect {
+  std::ostream *&out;
+  std::ostream *save;
+public:
+  redirect(std::ostream *&out, std::ostream& s) : out(out), save(out) {
+    out=&s;
+  }
+  ~redirect() {out=save;}
+};
+
+// Append the value x, mapped from [min,max] to an unsigned integer with the
+// given number of bytes, to the mesh data s.
+static void put(string& s, double x, double min, double max, int bytes)
+{
+  double v=max > min ? (x-min)/(max-min) : 0.0;
+  if(v < 0.0) v=0.0;
+  else if(v > 1.0) v=1.0;
+  double range=bytes == 4 ? 4294967295.0 : 65535.0;
+  unsigned long u=(unsigned long) (v*range+0.5);
+  for(int i=bytes-1; i >= 0; --i)
+    s += (char) ((u >> (8*i)) & 0xFF);
+}
+
+static void put(string& s, const pair& z, const bbox& b)
+{
+  put(s,z.getx(),b.left,b.right,4);
+  put(s,z.gety(),b.bottom,b.top,4);
+}
+
+static void put(string& s, pen *p, ColorSpace colorspace)
+{
+  p->convert();
+  if(!p->promote(colorspace))
+    reportError(inconsistent);
+  if(p->cmyk()) {
+    put(s,p->cyan(),0.0,1.0,2);
+    put(s,p->magenta(),0.0,1.0,2);
+    put(s,p->yellow(),0.0,1.0,2);
+    put(s,p->black(),0.0,1.0,2);
+  } else if(p->rgb()) {
+    put(s,p->red(),0.0,1.0,2);
+    put(s,p->green(),0.0,1.0,2);
+    put(s,p->blue(),0.0,1.0,2);
+  } else if(p->grayscale())
+    put(s,p->gray(),0.0,1.0,2);
+}
+
+pdffile::pdffile(const string& filename) : supported(true)
+{
+  this->filename=filename;
+  pdfformat=true;
+  pdf=true;
+  transparency=false;
+  buffer=NULL;
+  out=&content;
+  content.setf(std::ios::boolalpha);
+}
+
+pdffile::~pdffile()
+{
+  out=NULL;
+}
+
+size_t pdffile::object(const string& body)
+{
+  mem::map<CONST string,size_t>::iterator p=shared.find(body);
+  if(p != shared.end()) return p->second;
+  objects.push_back(body);
+  size_t n=objects.size();
+  shared[body]=n;
+  return n;
+}
+
+size_t pdffile::stream(const string& dict, const string& data)
+{
+  ostringstream compressed;
+  {
+    encodeFlate e(&compressed);
+    e.put((const unsigned char *) data.data(),data.size());
+    e.close();
+  }
+  return flatestream(dict,compressed.str());
+}
+
+size_t pdffile::flatestream(const string& dict, const string& compressed)
+{
+  ostringstream buf;
+  buf << "<< " << dict << (dict.empty() ? "" : " ")
+      << "/Length " << compressed.size() << " /Filter /FlateDecode >>" << newl
+      << "stream" << newl << compressed << newl << "endstream";
+  return object(buf.str());
+}
+
+string pdffile::name(ostringstream& s, const string& prefix, size_t n)
+{
+  ostringstream buf;
+  buf << "/" << prefix << n;
+  if(named.insert(n).second)
+    s << buf.str() << " " << n << " 0 R ";
+  return buf.str();
+}
+
+void pdffile::prologue(const bbox& box)
+{
+  this->box=box;
+  // Reserve the catalog, page tree, and page objects.
+  objects.resize(3);
+}
+
+void pdffile::epilogue()
+{
+  // The content stream is owned by this object, not by psfile::close.
+  out=NULL;
+  if(!supported) return;
+
+  size_t contents=stream("",content.str());
+
+  ostringstream resources;
+  resources << "<< /ProcSet [/PDF /ImageB /ImageC]";
+  if(!extgstate.str().empty())
+    resources << " /ExtGState << " << extgstate.str() << ">>";
+  if(!shading.str().empty())
+    resources << " /Shading << " << shading.str() << ">>";
+  if(!xobject.str().empty())
+    resources << " /XObject << " << xobject.str() << ">>";
+  resources << " >>";
+  size_t resourcesobj=object(resources.str());
+
+  objects[0]="<< /Type /Catalog /Pages 2 0 R >>";
+  objects[1]="<< /Type /Pages /Kids [3 0 R] /Count 1 >>";
+  ostringstream page;
+  page << "<< /Type /Page /Parent 2 0 R /MediaBox [" << box.left << " "
+       << box.bottom << " " << box.right << " " << box.top << "]"
+       << " /Resources " << resourcesobj << " 0 R"
+       << " /Contents " << contents << " 0 R >>";
+  objects[2]=page.str();
+
+  time_t t; time(&t);
+  char date[32];
+  strftime(date,sizeof(date),"D:%Y%m%d%H%M%S",localtime(&t));
+  ostringstream info;
+  info << "<< /Producer (" << settings::PROGRAM << " " << settings::VERSION
+       << REVISION << ") /CreationDate (" << date << ") >>";
+  size_t infoobj=object(info.str());
+
+  ofstream pdf(filename.c_str(),std::ios::binary);
+  if(!pdf)
+    reportError("Cannot write to "+filename);
+
+  pdf << "%PDF-1.4" << newl << "%\342\343\317\323" << newl;
+  size_t n=objects.size();
+  mem::vector<std::streamoff> offsets(n);
+  for(size_t i=0; i < n; ++i) {
+    offsets[i]=pdf.tellp();
+    pdf << i+1 << " 0 obj" << newl << objects[i] << newl << "endobj" << newl;
+  }
+
+  std::streamoff xref=pdf.tellp();
+  pdf << "xref" << newl << "0 " << n+1 << newl
+      << "0000000000 65535 f " << newl;
+  char entry[21];
+  for(size_t i=0; i < n; ++i) {
+    sprintf(entry,"%010lu 00000 n ",(unsigned long) offsets[i]);
+    pdf << entry << newl;
+  }
+  pdf << "trailer" << newl
+      << "<< /Size " << n+1 << " /Root 1 0 R /Info " << infoobj << " 0 R >>"
+      << newl << "startxref" << newl << xref << newl << "%%EOF" << newl;
+
+  if(!pdf.good())
+    reportError("Cannot write to "+filename);
+}
+
+void pdffile::setopacity(const pen& p)
+{
+  if(p.blend() != lastpen.blend() || p.opacity() != lastpen.opacity()) {
+    string blend=p.blend();
+    if(blend == "Compatible") blend="Normal";
+    ostringstream buf;
+    buf << "<< /Type /ExtGState /CA " << p.opacity() << " /ca " << p.opacity()
+        << " /BM /" << blend << " >>";
+    *out << name(extgstate,"GS",object(buf.str())) << " gs" << newl;
+    transparency=true;
+  }
+
+  lastpen.settransparency(p);
+}
+
+void pdffile::setpen(pen p)
+{
+  p.convert();
+
+  setopacity(p);
+
+  if(!p.fillpattern().empty()) {
+    unsupported();
+    return;
+  }
+
+  // Set both the stroking and nonstroking colors.
+  if(p.cmyk() && (!lastpen.cmyk() ||
+                  (p.cyan() != lastpen.cyan() ||
+                   p.magenta() != lastpen.magenta() ||
+                   p.yellow() != lastpen.yellow() ||
+                   p.black() != lastpen.black()))) {
+    write(p); *out << " k";
+    write(p); *out << " K" << newl;
+  } else if(p.rgb() && (!lastpen.rgb() ||
+                        (p.red() != lastpen.red() ||
+                         p.green() != lastpen.green() ||
+                         p.blue() != lastpen.blue()))) {
+    write(p); *out << " rg ";
+    write(p); *out << " RG" << newl;
+  } else if(p.grayscale() && (!lastpen.grayscale() ||
+                              p.gray() != lastpen.gray())) {
+    write(p); *out << " g ";
+    write(p); *out << " G" << newl;
+  }
+
+  if(p.width() != lastpen.width())
+    *out << p.width() << " w" << newl;
+
+  if(p.cap() != lastpen.cap())
+    *out << p.cap() << " J" << newl;
+
+  if(p.join() != lastpen.join())
+    *out << p.join() << " j" << newl;
+
+  if(p.miter() != lastpen.miter())
+    *out << p.miter() << " M" << newl;
+
+  const LineType *linetype=p.linetype();
+  const LineType *lastlinetype=lastpen.linetype();
+
+  if(!(linetype->pattern == lastlinetype->pattern) ||
+     linetype->offset != lastlinetype->offset) {
+    out->setf(std::ios::fixed);
+    *out << linetype->pattern << " " << linetype->offset << " d" << newl;
+    out->unsetf(std::ios::fixed);
+  }
+
+  lastpen=p;
+}
+
+void pdffile::latticeshade(const array& a, const transform& t)
+{
+  size_t n=a.size();
+  if(n == 0) return;
+
+  array *a0=read<array *>(a,0);
+  size_t m=a0->size();
+  setfirstopacity(*a0);
+
+  ColorSpace colorspace=maxcolorspace2(a);
+  checkColorSpace(colorspace);
+
+  size_t ncomponents=ColorComponents[colorspace];
+
+  string data(ncomponents*m*n,'\0');
+  unsigned char *b=(unsigned char *) &data[0];
+  for(size_t i=n; i > 0;) {
+    array *ai=read<array *>(a,--i);
+    checkArray(ai);
+    size_t aisize=ai->size();
+    if(aisize != m) reportError("matrix is not rectangular");
+    for(size_t j=0; j < m; j++) {
+      pen *p=read<pen *>(ai,j);
+      p->convert();
+      if(!p->promote(colorspace))
+        reportError(inconsistent);
+      penbytes(p,b,ncomponents);
+      b += ncomponents;
+    }
+  }
+
+  ostringstream function;
+  function << "/FunctionType 0 /Order 1 /Domain [0 1 0 1] /Range [";
+  for(size_t i=0; i < ncomponents; ++i)
+    function << "0 1 ";
+  function << "] /Decode [";
+  for(size_t i=0; i < ncomponents; ++i)
+    function << "0 1 ";
+  function << "] /BitsPerSample 8 /Size [" << m << " " << n << "]";
+
+  size_t f=stream(function.str(),data);
+
+  ostringstream buf;
+  {
+    redirect r(out,buf);
+    *out << "<< /ShadingType 1 /Matrix [";
+    write(t);
+    *out << "] /ColorSpace /Device" << ColorDeviceSuffix[colorspace]
+         << " /Function " << f << " 0 R >>";
+  }
+  *out << name(shading,"Sh",object(buf.str())) << " sh" << newl;
+}
+
+// Axial and radial shading
+void pdffile::gradientshade(bool axial, ColorSpace colorspace,
+                            const pen& pena, const pair& a, double ra,
+                            bool extenda, const pen& penb, const pair& b,
+                            double rb, bool extendb)
+{
+  setopacity(pena);
+  checkColorSpace(colorspace);
+
+  ostringstream buf;
+  buf.setf(std::ios::boolalpha);
+  {
+    redirect r(out,buf);
+    *out << "<< /ShadingType " << (axial ? "2" : "3")
+         << " /ColorSpace /Device" << ColorDeviceSuffix[colorspace]
+         << " /Coords [";
+    write(a);
+    if(!axial) write(ra);
+    write(b);
+    if(!axial) write(rb);
+    *out << "] /Extend [" << extenda << " " << extendb << "]"
+         << " /Function << /FunctionType 2 /Domain [0 1] /C0 [";
+    write(pena);
+    *out << "] /C1 [";
+    write(penb);
+    *out << "] /N 1 >> >>";
+  }
+  *out << name(shading,"Sh",object(buf.str())) << " sh" << newl;
+}
+
+// Emit a free-form triangle (type 4) or tensor-product patch (type 7) mesh
+// shading with 32-bit coordinates spanning b and 16-bit color components.
+void pdffile::meshshade(int type, ColorSpace colorspace, const string& data,
+                        const bbox& b)
+{
+  ostringstream dict;
+  dict << "/ShadingType " << type << " /ColorSpace /Device"
+       << ColorDeviceSuffix[colorspace]
+       << " /BitsPerCoordinate 32 /BitsPerComponent 16 /BitsPerFlag 8"
+       << " /Decode [" << b.left << " " << b.right << " " << b.bottom << " "
+       << b.top;
+  size_t ncomponents=ColorComponents[colorspace];
+  for(size_t i=0; i < ncomponents; ++i)
+    dict << " 0 1";
+  dict << "]";
+  *out << name(shading,"Sh",stream(dict.str(),data)) << " sh" << newl;
+}
+
+// Expand a degenerate mesh bounding box so that it has nonzero extent.
+static bbox meshbox(bbox b)
+{
+  if(b.right <= b.left) b.right=b.left+1.0;
+  if(b.top <= b.bottom) b.top=b.bottom+1.0;
+  return b;
+}
+
+void pdffile::gouraudshade(const pen& pentype, const array& pens,
+                           const array& vertices, const array& edges)
+{
+  size_t size=pens.size();
+  if(size == 0) return;
+
+  setfirstopacity(pens);
+  ColorSpace colorspace=maxcolorspace(pens);
+  checkColorSpace(colorspace);
+
+  bbox b;
+  for(size_t i=0; i < size; i++)
+    b += read<pair>(vertices,i);
+  b=meshbox(b);
+
+  string data;
+  for(size_t i=0; i < size; i++) {
+    data += (char) read<Int>(edges,i);
+    put(data,read<pair>(vertices,i),b);
+    put(data,read<pen *>(pens,i),colorspace);
+  }
+  meshshade(4,colorspace,data,b);
+}
+
+// Tensor-product patch shading
+void pdffile::tensorshade(const pen& pentype, const array& pens,
+                          const array& boundaries, const array& z)
+{
+  size_t size=pens.size();
+  if(size == 0) return;
+  size_t nz=z.size();
+
+  array *p0=read<array *>(pens,0);
+  if(checkArray(p0) != 4)
+    reportError("4 pens required");
+  setfirstopacity(*p0);
+
+  ColorSpace colorspace=maxcolorspace2(pens);
+  checkColorSpace(colorspace);
+
+  // Control points in the order required by the PDF data stream.
+  mem::vector<pair> Z(16*size);
+  bbox b;
+  for(size_t i=0; i < size; i++) {
+    pair *z16=&Z[16*i];
+    path g=read<path>(boundaries,i);
+    if(!(g.cyclic() && g.size() == 4))
+      reportError("specify cyclic path of length 4");
+    size_t k=0;
+    for(Int j=4; j > 0; --j) {
+      z16[k++]=g.point(j);
+      z16[k++]=g.precontrol(j);
+      z16[k++]=g.postcontrol(j-1);
+    }
+    if(nz == 0) { // Coons patch
+      static double nineth=1.0/9.0;
+      for(Int j=0; j < 4; ++j) {
+        z16[k++]=nineth*(-4.0*g.point(j)+6.0*(g.precontrol(j)+
+                                               g.postcontrol(j))
+                         -2.0*(g.point(j-1)+g.point(j+1))
+                         +3.0*(g.precontrol(j-1)+g.postcontrol(j+1))
+                         -g.point(j+2));
+      }
+    } else {
+      array *zi=read<array *>(z,i);
+      if(checkArray(zi) != 4)
+        reportError("specify 4 internal control points for each path");
+      z16[k++]=read<pair>(zi,0);
+      z16[k++]=read<pair>(zi,3);
+      z16[k++]=read<pair>(zi,2);
+      z16[k++]=read<pair>(zi,1);
+    }
+    for(size_t j=0; j < 16; ++j)
+      b += z16[j];
+  }
+  b=meshbox(b);
+
+  string data;
+  for(size_t i=0; i < size; i++) {
+    data += (char) 0;
+    for(size_t j=0; j < 16; ++j)
+      put(data,Z[16*i+j],b);
+    array *pi=read<array *>(pens,i);
+    if(checkArray(pi) != 4)
+      reportError("specify 4 pens for each path");
+    put(data,read<pen *>(pi,0),colorspace);
+    put(data,read<pen *>(pi,3),colorspace);
+    put(data,read<pen *>(pi,2),colorspace);
+    put(data,read<pen *>(pi,1),colorspace);
+  }
+  meshshade(7,colorspace,data,b);
+}
+
+void pdffile::imageheader(size_t width, size_t height, ColorSpace colorspace)
+{
+  imagewidth=width;
+  imageheight=height;
+  imagecolorspace=colorspace;
+}
+
+encoder *pdffile::newencoder()
+{
+  imagedata.str("");
+  return new encodeFlate(&imagedata);
+}
+
+void pdffile::outImage()
+{
+  ostringstream dict;
+  dict << "/Type /XObject /Subtype /Image /Width " << imagewidth
+       << " /Height " << imageheight << " /ColorSpace /Device"
+       << ColorDeviceSuffix[imagecolorspace] << " /BitsPerComponent 8";
+  size_t n=flatestream(dict.str(),imagedata.str());
+  imagedata.str("");
+
+  // PostScript images have their first row at the bottom of the unit square.
+  *out << "q 1 0 0 -1 0 1 cm " << name(xobject,"Im",n) << " Do Q" << newl;
+}
+
+} //namespace camp
@@ -0,0 +1,91 @@
+/*****
+ * pdffile.h
+ *
+ * Writes pictures without labels directly to a PDF file.
+ *****/
+
+#ifndef PDFFILE_H
+#define PDFFILE_H
+
+#include <set>
+
+#include "psfile.h"
+
+namespace camp {
+
+class pdffile : public psfile {
+  ostringstream content;        // page content stream
+  mem::vector<string> objects;  // bodies of the indirect objects
+  mem::map<CONST string,size_t> shared; // object numbers of shared bodies
+  ostringstream extgstate,shading,xobject; // resource dictionary entries
+  std::set<size_t> named;       // objects listed in a resource dictionary
+  bbox box;
+  bool supported;
+
+  size_t imagewidth,imageheight;
+  ColorSpace imagecolorspace;
+  ostringstream imagedata;      // compressed data of the current image
+
+  // Return the number of the indirect object with the given body; identical
+  // objects are written only once.
+  size_t object(const string& body);
+
+  // Return the number of a Flate-compressed stream object with the given
+  // dictionary entries.
+  size_t stream(const string& dict, const string& data);
+
+  // As stream, for data that is already compressed.
+  size_t flatestream(const string& dict, const string& compressed);
+
+  // Return the resource name prefix+n, listing object n in the resource
+  // dictionary s.
+  string name(ostringstream& s, const string& prefix, size_t n);
+
+  void meshshade(int type, ColorSpace colorspace, const string& data,
+                 const bbox& b);
+
+public:
+  pdffile(const string& filename);
+  ~pdffile();
+
+  // Could every element be represented directly in PDF?
+  bool Supported() {return supported;}
+
+  void unsupported() {supported=false;}
+
+  void prologue(const bbox& box);
+  void epilogue();
+
+  void setpen(pen p);
+  void setopacity(const pen& p);
+
+  void translate(pair z) {
+    if(z == pair(0.0,0.0)) return;
+    *out << "1 0 0 1";
+    write(z);
+    *out << " cm" << newl;
+  }
+
+  void strokepath() {unsupported();}
+
+  void latticeshade(const vm::array& a, const transform& t);
+  void gradientshade(bool axial, ColorSpace colorspace,
+                     const pen& pena, const pair& a, double ra,
+                     bool extenda, const pen& penb, const pair& b,
+                     double rb, bool extendb);
+  void gouraudshade(const pen& pentype, const vm::array& pens,
+                    const vm::array& vertices, const vm::array& edges);
+  void tensorshade(const pen& pentype, const vm::array& pens,
+                   const vm::array& boundaries, const vm::array& z);
+
+  void imageheader(size_t width, size_t height, ColorSpace colorspace);
+  encoder *newencoder();
+  void outImage();
+
+  void verbatimline(const string&) {unsupported();}
+  void verbatim(const string&) {unsupported();}
+};
+
+} //namespace camp
+
+#endif
@@ -14,6 +14,10 @@
 #include "drawverbatim.h"
 #include "drawlabel.h"
 #include "drawlayer.h"
+#include "drawsimplify.h"
+#include "pdffile.h"
+#include "pngfile.h"
+#include "svgfile.h"
 
 using std::ifstream;
 using std::ofstream;
@@ -210,12 +214,27 @@ void picture::append(drawElement *p)
   nodes.push_back(p);
 }
 
+// Does pic change the path simplification tolerance?
+static bool simplifies(picture &pic)
+{
+  for(picture::nodelist::iterator p=pic.nodes.begin(); p != pic.nodes.end();
+      ++p)
+    if((*p)->simplify()) return true;
+  return false;
+}
+
 void picture::add(picture &pic)
 {
   if (&pic == this) return;
 
+  // Confine any change of the simplification tolerance to pic.
+  bool scope=simplifies(pic);
+  if(scope) nodes.push_back(new drawSimplifyScope(true));
+  
   // STL's funny way of copying one list into another.
   copy(pic.nodes.begin(), pic.nodes.end(), back_inserter(nodes));
+  
+  if(scope) nodes.push_back(new drawSimplifyScope(false));
 }
 
 // Insert picture pic at beginning of picture.
@@ -223,7 +242,12 @@ void picture::prepend(picture &pic)
 {
   if (&pic == this) return;
   
+  bool scope=simplifies(pic);
+  if(scope) nodes.push_front(new drawSimplifyScope(false));
+  
   copy(pic.nodes.begin(), pic.nodes.end(), inserter(nodes, nodes.begin()));
+  
+  if(scope) nodes.push_front(new drawSimplifyScope(true));
   lastnumber=0;
   lastnumber3=0;
 }
@@ -661,7 +685,8 @@ bool picture::postprocess(const string& prename, const string& outname,
   bool pdfformat=(settings::pdf(getSetting<string>("tex")) 
                   && outputformat == "") || outputformat == "pdf";
   
-  if(pdftex || !epsformat) {
+  // Files written directly in the output format need no conversion.
+  if((pdftex || !epsformat) && prename != outname) {
     if(pdfformat) {
       if(pdftex) {
         status=rename(prename.c_str(),outname.c_str());
@@ -777,6 +802,104 @@ string Outname(const string& prefix, const string& outputformat,
   return standardout ? "-" : buildname(prefix,outputformat,"");
 }
 
+// Background shipout jobs, oldest first.
+struct shipoutjob {
+  int pid;
+  string prefix;
+  string outname;
+  shipoutjob(int pid, const string& prefix, const string& outname) :
+    pid(pid), prefix(prefix), outname(outname) {}
+};
+
+static mem::list<shipoutjob> shipoutjobs;
+
+static bool shipoutreap(int pid)
+{
+  int status;
+  return waitpid(pid,&status,0) == pid && WIFEXITED(status) &&
+    WEXITSTATUS(status) == 0;
+}
+
+// Wait for background shipout jobs until at most n remain running.
+static void shipoutwait(size_t n)
+{
+  bool failed=false;
+  while(shipoutjobs.size() > n) {
+    int pid=shipoutjobs.front().pid;
+    shipoutjobs.pop_front();
+    if(!shipoutreap(pid)) failed=true;
+  }
+  if(failed) reportError("shipout failed");
+}
+
+// Wait for any background shipout job still writing the files of prefix or
+// outname.
+static void shipoutwait(const string& prefix, const string& outname)
+{
+  bool failed=false;
+  for(mem::list<shipoutjob>::iterator p=shipoutjobs.begin();
+      p != shipoutjobs.end();) {
+    if(p->prefix == prefix || p->outname == outname) {
+      if(!shipoutreap(p->pid)) failed=true;
+      p=shipoutjobs.erase(p);
+    } else ++p;
+  }
+  if(failed) reportError("shipout failed");
+}
+
+void shipoutwait()
+{
+  shipoutwait(0);
+}
+
+// Fork a background job to complete the shipout of prefix to outname once
+// a job slot is free. Return 0 in the job, its process id in the caller, or
+// -1 if the shipout should be completed in the foreground. Only the calling
+// thread survives a fork, so the foreground is used while other threads,
+// which might hold locks the job needs, are running.
+static int shipoutfork(const string& prefix, const string& outname)
+{
+  Int jobs=getSetting<Int>("jobs");
+  if(jobs <= 0) jobs=sysconf(_SC_NPROCESSORS_ONLN);
+  if(jobs <= 1 || glthread || helperthreads > 0) return -1;
+  
+  shipoutwait(jobs-1);
+  cout.flush();
+  int pid=fork();
+  if(pid == -1) return -1;
+  if(pid == 0) shipoutjobs.clear();
+  else shipoutjobs.push_back(shipoutjob(pid,prefix,outname));
+  return pid;
+}
+
+// Draw a picture without labels to a file that writes its output format
+// directly. Return false if some element could not be represented.
+template<class T>
+bool drawdirect(T& out, picture *preamble, picture::nodelist& nodes,
+                const bbox& bshift, const pair& bboxshift)
+{
+  out.prologue(bshift);
+  out.gsave();
+  out.translate(bboxshift);
+  if(preamble) {
+    picture::nodelist Nodes=preamble->nodes;
+    for(picture::nodelist::iterator P=Nodes.begin(); P != Nodes.end(); ++P) {
+      assert(*P);
+      (*P)->draw(&out);
+    }
+  }
+  out.resetpen();
+  for(picture::nodelist::iterator p=nodes.begin(); p != nodes.end() &&
+        out.Supported(); ++p) {
+    assert(*p);
+    (*p)->draw(&out);
+  }
+  out.grestore();
+  out.epilogue();
+  out.close();
+  return out.Supported();
+}
+
 bool picture::shipout(picture *preamble, const string& Prefix,
                       const string& format, double magnification,
                       bool wait, bool view)
@@ -799,6 +922,7 @@ bool picture::shipout(picture *preamble, const string& Prefix,
   
   bool xobject=magnification > 0;
   string outname=Outname(prefix,outputformat,standardout);
+  if(!standardout) shipoutwait(prefix,outname);
   string epsname=epsformat ? (standardout ? "" : outname) :
     auxname(prefix,"eps");
   
@@ -815,6 +939,10 @@ bool picture::shipout(picture *preamble, const string& Prefix,
     return postprocess(epsname,outname,outputformat,1.0,wait,view,false,false);
   }
   
+  bool svgwriter=outputformat == "svg" && !Labels &&
+    getSetting<bool>("svgwriter") &&
+    (!have3D() || getSetting<double>("render") == 0.0);
+  
   Labels |= svgformat;
     
   if(Labels)
@@ -857,8 +985,36 @@ bool picture::shipout(picture *preamble, const string& Prefix,
     }
   }
   
+  if((!Labels || svgwriter) && !xobject && !standardout) {
+    // Write the output format directly, falling back to the usual pipeline
+    // for elements that cannot be represented.
+    bbox bshift=b;
+    bshift.shift(bboxshift);
+    if(outputformat == "pdf" && getSetting<bool>("pdfwriter") &&
+       !getSetting<bool>("autorotate")) {
+      pdffile out(outname);
+      if(drawdirect(out,preamble,nodes,bshift,bboxshift)) {
+        transparency=out.Transparency();
+        return postprocess(outname,outname,outputformat,magnification,wait,
+                           view,true,false);
+      }
+    } else if(outputformat == "png" && getSetting<bool>("pngwriter")) {
+      double render=fabs(getSetting<double>("render"));
+      if(render == 0) render=1.0;
+      pngfile out(outname,render);
+      if(drawdirect(out,preamble,nodes,bshift,bboxshift))
+        return postprocess(outname,outname,outputformat,magnification,wait,
+                           view,false,false);
+    } else if(svgwriter) {
+      svgfile out(outname);
+      if(drawdirect(out,preamble,nodes,bshift,bboxshift))
+        return postprocess(outname,outname,outputformat,magnification,wait,
+                           view,false,false);
+    }
+  }
+
   bool status=true;
-  
+
   string texname;
   texfile *tex=NULL;
   
@@ -1041,27 +1197,52 @@ bool picture::shipout(picture *preamble, const string& Prefix,
     } else {
       if(Labels) {
         tex->epilogue();
-        if(context) prefix=stripDir(prefix);
-        status=texprocess(texname,svgformat ? outname : prename,prefix,
-                          bboxshift,svgformat);
         delete tex;
-        if(!getSetting<bool>("keep")) {
-          for(mem::list<string>::iterator p=files.begin(); p != files.end();
-              ++p)
-            unlink(p->c_str());
-        }
       }
-      if(status) {
-        if(xobject) {
-          if(pdf || transparency)
-            status=(epstopdf(prename,Outname(prefix,"pdf",standardout)) == 0);
-        } else {
-          if(context) prename=stripDir(prename);
-          status=postprocess(prename,outname,outputformat,magnification,wait,
-                             view,pdf && Labels,svgformat);
-          if(pdfformat && !getSetting<bool>("keep"))
-            unlink(auxname(prefix,"m9").c_str());
+      
+      // The external processing of pictures that are not viewed may be
+      // completed by a background job.
+      bool background=!xobject && !standardout &&
+        !(settings::view() && view);
+      // TeX may include the output of earlier shipouts, so let their
+      // background jobs finish first.
+      if(Labels) shipoutwait();
+      int pid=background ? shipoutfork(Prefix,outname) : -1;
+      if(pid > 0) return true;
+      
+      try {
+        if(Labels) {
+          if(context) prefix=stripDir(prefix);
+          status=texprocess(texname,svgformat ? outname : prename,prefix,
+                            bboxshift,svgformat);
+          if(!getSetting<bool>("keep")) {
+            for(mem::list<string>::iterator p=files.begin();
+                p != files.end(); ++p)
+              unlink(p->c_str());
+          }
         }
+        if(status) {
+          if(xobject) {
+            if(pdf || transparency)
+              status=(epstopdf(prename,Outname(prefix,"pdf",standardout))
+                      == 0);
+          } else {
+            if(context) prename=stripDir(prename);
+            status=postprocess(prename,outname,outputformat,magnification,
+                               wait,view,pdf && Labels,svgformat);
+            if(pdfformat && !getSetting<bool>("keep"))
+              unlink(auxname(prefix,"m9").c_str());
+          }
+        }
+      } catch(...) {
+        // A background job must never return to the interpreter.
+        if(pid < 0) throw;
+        status=false;
+      }
+      
+      if(pid == 0) {
+        cout.flush();
+        _exit(status ? 0 : 1);
       }
     }
   }
@@ -119,6 +119,9 @@ void texinit();
 int opentex(const string& texname, const string& prefix, bool dvi=false);
 
 const char *texpathmessage();
+
+// Wait for all background shipout jobs to finish.
+void shipoutwait();
   
 } //namespace camp
 
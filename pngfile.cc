@@ -0,0 +1,1199 @@
+/*****
+ * pngfile.cc
+ *
+ * Rasterizes pictures without labels directly to a PNG file.
+ *
+ * Fills, strokes and clipping paths are flattened to polygons in device
+ * coordinates and scan converted with exact horizontal coverage on
+ * several subscanlines per pixel row. Rows are divided into bands that
+ * are rasterized concurrently.
+ *****/
+
+#include <cfloat>
+#include <algorithm>
+#include <zlib.h>
+
+#include "pngfile.h"
+#include "util.h"
+#include "settings.h"
+
+using std::ofstream;
+using vm::array;
+using vm::read;
+
+namespace camp {
+
+void checkColorSpace(ColorSpace colorspace);
+
+static const char *inconsistent="inconsistent colorspaces";
+
+// Subscanlines per pixel row.
+static const int subsamples=8;
+
+// Maximum deviation in pixels of a flattened curve or arc, unless a coarser
+// path simplification tolerance is in effect.
+static const double flatness=0.1;
+
+// Minimum number of pixels in a band worth rasterizing in its own thread.
+static const size_t bandpixels=65536;
+
+struct pngmask {
+  std::vector<unsigned char> a;
+  size_t x0,y0,x1,y1;   // bounds of the covered region
+};
+
+// The RGB color and opacity to paint at a device point.
+class pngpainter {
+public:
+  virtual ~pngpainter() {}
+  virtual bool color(double x, double y, float *c, float& a) const=0;
+};
+
+static void rgb(pen p, float *c)
+{
+  p.convert();
+  p.torgb();
+  c[0]=p.red();
+  c[1]=p.green();
+  c[2]=p.blue();
+}
+
+class solidpainter : public pngpainter {
+  float c[3];
+public:
+  solidpainter(const pen& p) {rgb(p,c);}
+
+  bool color(double, double, float *C, float& a) const {
+    C[0]=c[0]; C[1]=c[1]; C[2]=c[2];
+    return true;
+  }
+};
+
+class axialpainter : public pngpainter {
+  transform T;
+  pair a,d;
+  double invlength2;
+  bool extenda,extendb;
+  float ca[3],cb[3];
+public:
+  axialpainter(const transform& t, const pen& pena, const pair& a,
+               bool extenda, const pen& penb, const pair& b, bool extendb)
+    : T(inverse(t)), a(a), d(b-a), extenda(extenda), extendb(extendb) {
+    double l2=d.abs2();
+    invlength2=l2 > 0.0 ? 1.0/l2 : 0.0;
+    rgb(pena,ca);
+    rgb(penb,cb);
+  }
+
+  bool color(double x, double y, float *c, float&) const {
+    double s=dot(T*pair(x,y)-a,d)*invlength2;
+    if(s < 0.0) {
+      if(!extenda) return false;
+      s=0.0;
+    } else if(s > 1.0) {
+      if(!extendb) return false;
+      s=1.0;
+    }
+    for(size_t i=0; i < 3; ++i)
+      c[i]=ca[i]+s*(cb[i]-ca[i]);
+    return true;
+  }
+};
+
+class radialpainter : public pngpainter {
+  transform T;
+  pair a,d;
+  double ra,dr;
+  bool extenda,extendb;
+  float ca[3],cb[3];
+
+  bool valid(double s) const {
+    return ra+s*dr >= 0.0 && (s >= 0.0 || extenda) && (s <= 1.0 || extendb);
+  }
+public:
+  radialpainter(const transform& t, const pen& pena, const pair& a,
+                double ra, bool extenda, const pen& penb, const pair& b,
+                double rb, bool extendb)
+    : T(inverse(t)), a(a), d(b-a), ra(ra), dr(rb-ra), extenda(extenda),
+      extendb(extendb) {
+    rgb(pena,ca);
+    rgb(penb,cb);
+  }
+
+  // Find the largest s for which the point lies on the circle centered at
+  // a+s*d with radius ra+s*dr.
+  bool color(double x, double y, float *c, float&) const {
+    pair p=T*pair(x,y)-a;
+    double A=d.abs2()-dr*dr;
+    double B=dot(p,d)+ra*dr;
+    double C=p.abs2()-ra*ra;
+    double s;
+    if(fabs(A) < 1.0e-12*(d.abs2()+dr*dr)) {
+      if(B == 0.0) return false;
+      s=0.5*C/B;
+      if(!valid(s)) return false;
+    } else {
+      double discriminant=B*B-A*C;
+      if(discriminant < 0.0) return false;
+      double root=sqrt(discriminant);
+      double s1=(B+root)/A;
+      double s2=(B-root)/A;
+      if(s1 < s2) std::swap(s1,s2);
+      if(valid(s1)) s=s1;
+      else if(valid(s2)) s=s2;
+      else return false;
+    }
+    if(s < 0.0) s=0.0;
+    else if(s > 1.0) s=1.0;
+    for(size_t i=0; i < 3; ++i)
+      c[i]=ca[i]+s*(cb[i]-ca[i]);
+    return true;
+  }
+};
+
+// Bilinearly interpolated samples spanning the unit square, with the first
+// row at the bottom.
+class samplepainter : public pngpainter {
+  transform T;
+  size_t m,n;
+  std::vector<float> c;
+  bool interpolate;
+public:
+  samplepainter(const transform& t, size_t m, size_t n, bool interpolate)
+    : T(inverse(t)), m(m), n(n), c(3*m*n), interpolate(interpolate) {}
+
+  float *sample(size_t i, size_t j) {return &c[3*(m*i+j)];}
+
+  bool color(double x, double y, float *C, float&) const {
+    pair z=T*pair(x,y);
+    double u=z.getx(), v=z.gety();
+    if(u < 0.0 || u > 1.0 || v < 0.0 || v > 1.0) return false;
+    if(!interpolate) {
+      size_t j=std::min((size_t) (u*m),m-1);
+      size_t i=std::min((size_t) (v*n),n-1);
+      const float *s=&c[3*(m*i+j)];
+      C[0]=s[0]; C[1]=s[1]; C[2]=s[2];
+      return true;
+    }
+    double U=m > 1 ? u*(m-1) : 0.0;
+    double V=n > 1 ? v*(n-1) : 0.0;
+    size_t j=std::min((size_t) U,m > 1 ? m-2 : 0);
+    size_t i=std::min((size_t) V,n > 1 ? n-2 : 0);
+    double fu=U-j, fv=V-i;
+    size_t j1=m > 1 ? j+1 : j;
+    size_t i1=n > 1 ? i+1 : i;
+    const float *s00=&c[3*(m*i+j)], *s01=&c[3*(m*i+j1)];
+    const float *s10=&c[3*(m*i1+j)], *s11=&c[3*(m*i1+j1)];
+    for(size_t k=0; k < 3; ++k)
+      C[k]=(1.0-fv)*((1.0-fu)*s00[k]+fu*s01[k])+
+        fv*((1.0-fu)*s10[k]+fu*s11[k]);
+    return true;
+  }
+};
+
+// Composite color c with opacity a onto the premultiplied pixel p.
+inline void blend(float *p, const float *c, float a)
+{
+  float b=1.0f-a;
+  p[0]=c[0]*a+p[0]*b;
+  p[1]=c[1]*a+p[1]*b;
+  p[2]=c[2]*a+p[2]*b;
+  p[3]=a+p[3]*b;
+}
+
+// Receives the antialiased coverage of pixels x0 to x1-1 in row y.
+class coveragesink {
+public:
+  virtual ~coveragesink() {}
+  virtual void row(size_t y, const float *cov, size_t x0, size_t x1) const=0;
+};
+
+class compositor : public coveragesink {
+  std::vector<float>& canvas;
+  size_t width;
+  const pngmask *mask;
+  const pngpainter& f;
+  float opacity;
+public:
+  compositor(std::vector<float>& canvas, size_t width, const pngmask *mask,
+             const pngpainter& f, double opacity)
+    : canvas(canvas), width(width), mask(mask), f(f), opacity(opacity) {}
+
+  void row(size_t y, const float *cov, size_t x0, size_t x1) const {
+    float *p=&canvas[4*width*y];
+    const unsigned char *m=mask ? &mask->a[width*y] : NULL;
+    double Y=y+0.5;
+    for(size_t x=x0; x < x1; ++x) {
+      float a=cov[x];
+      if(m) a *= m[x]*(1.0f/255.0f);
+      if(a <= 0.0f) continue;
+      float c[3];
+      float alpha=1.0f;
+      if(!f.color(x+0.5,Y,c,alpha)) continue;
+      blend(p+4*x,c,a*alpha*opacity);
+    }
+  }
+};
+
+class masker : public coveragesink {
+  pngmask *mask;
+  const pngmask *parent;
+  size_t width;
+public:
+  masker(pngmask *mask, const pngmask *parent, size_t width)
+    : mask(mask), parent(parent), width(width) {}
+
+  void row(size_t y, const float *cov, size_t x0, size_t x1) const {
+    unsigned char *m=&mask->a[width*y];
+    const unsigned char *p=parent ? &parent->a[width*y] : NULL;
+    for(size_t x=x0; x < x1; ++x) {
+      float a=cov[x]*255.0f;
+      if(p) a *= p[x]*(1.0f/255.0f);
+      m[x]=(unsigned char) (a+0.5f);
+    }
+  }
+};
+
+struct edge {
+  double x0,y0,y1,dxdy;
+  int winding;
+
+  bool operator < (const edge& e) const {return y0 < e.y0;}
+};
+
+struct crossing {
+  double x;
+  int winding;
+
+  bool operator < (const crossing& c) const {return x < c.x;}
+};
+
+class rasterizer {
+public:
+  std::vector<edge> edges;
+  double xmin,ymin,xmax,ymax;
+
+  rasterizer() : xmin(DBL_MAX), ymin(DBL_MAX), xmax(-DBL_MAX),
+                 ymax(-DBL_MAX) {}
+
+  bool empty() const {return edges.empty();}
+
+  // Add the implicitly closed polygon p.
+  void add(const polyline& p) {
+    size_t n=p.size();
+    if(n < 2) return;
+    for(size_t i=0; i < n; ++i) {
+      const pair& a=p[i];
+      const pair& b=p[i+1 < n ? i+1 : 0];
+      double ax=a.getx(), ay=a.gety();
+      double bx=b.getx(), by=b.gety();
+      xmin=std::min(xmin,ax); xmax=std::max(xmax,ax);
+      ymin=std::min(ymin,ay); ymax=std::max(ymax,ay);
+      if(ay == by) continue;
+      edge e;
+      if(ay < by) {
+        e.x0=ax; e.y0=ay; e.y1=by; e.winding=1;
+      } else {
+        e.x0=bx; e.y0=by; e.y1=ay; e.winding=-1;
+      }
+      e.dxdy=(bx-ax)/(by-ay);
+      edges.push_back(e);
+    }
+  }
+
+  void fill(size_t width, size_t y0, size_t y1, bool evenodd,
+            const coveragesink& sink);
+};
+
+struct band {
+  const rasterizer *r;
+  size_t width,y0,y1;
+  bool evenodd;
+  const coveragesink *sink;
+};
+
+static void rasterize(const band& b)
+{
+  const std::vector<edge>& e=b.r->edges;
+  size_t n=e.size();
+  size_t width=b.width;
+  std::vector<float> cov(width+1,0.0f),delta(width+1,0.0f);
+  std::vector<size_t> active;
+  std::vector<crossing> xs;
+  size_t next=0;
+  const float w=1.0f/subsamples;
+
+  for(size_t y=b.y0; y < b.y1; ++y) {
+    size_t left=width, right=0;
+    for(int s=0; s < subsamples; ++s) {
+      double Y=y+(s+0.5)/subsamples;
+      while(next < n && e[next].y0 <= Y) active.push_back(next++);
+      xs.clear();
+      size_t k=0;
+      for(size_t i=0; i < active.size(); ++i) {
+        const edge& E=e[active[i]];
+        if(E.y1 <= Y) continue;
+        active[k++]=active[i];
+        crossing c={E.x0+(Y-E.y0)*E.dxdy,E.winding};
+        xs.push_back(c);
+      }
+      active.resize(k);
+      std::sort(xs.begin(),xs.end());
+
+      int winding=0;
+      for(size_t i=0; i+1 < xs.size(); ++i) {
+        winding += xs[i].winding;
+        if(b.evenodd ? (winding & 1) == 0 : winding == 0) continue;
+        double xa=std::max(xs[i].x,0.0);
+        double xb=std::min(xs[i+1].x,(double) width);
+        if(xb <= xa) continue;
+        size_t ia=(size_t) xa, ib=(size_t) xb;
+        if(ia == ib) cov[ia] += (xb-xa)*w;
+        else {
+          cov[ia] += (ia+1-xa)*w;
+          delta[ia+1] += w;
+          delta[ib] -= w;
+          if(ib < width) cov[ib] += (xb-ib)*w;
+        }
+        left=std::min(left,ia);
+        right=std::max(right,std::min(ib+1,width));
+      }
+    }
+    if(left < right) {
+      float run=0.0f;
+      for(size_t x=left; x < right; ++x) {
+        run += delta[x];
+        delta[x]=0.0f;
+        float c=cov[x]+run;
+        cov[x]=c > 1.0f ? 1.0f : c;
+      }
+      delta[right]=0.0f;
+      b.sink->row(y,&cov[0],left,right);
+      std::fill(cov.begin()+left,cov.begin()+right,0.0f);
+    }
+  }
+}
+
+static void rasterizeBand(void *bands, size_t i)
+{
+  rasterize(((band *) bands)[i]);
+}
+
+void rasterizer::fill(size_t width, size_t y0, size_t y1, bool evenodd,
+                      const coveragesink& sink)
+{
+  if(edges.empty()) return;
+  y0=std::max(y0,(size_t) std::max(floor(ymin),0.0));
+  y1=std::min(y1,(size_t) std::max(ceil(ymax),0.0));
+  if(y0 >= y1) return;
+
+  std::sort(edges.begin(),edges.end());
+
+  size_t rows=y1-y0;
+  size_t n=std::min(threadcount(rows*width,bandpixels),rows);
+
+  std::vector<band> bands(n);
+  for(size_t i=0; i < n; ++i) {
+    band& b=bands[i];
+    b.r=this;
+    b.width=width;
+    b.y0=y0+rows*i/n;
+    b.y1=y0+rows*(i+1)/n;
+    b.evenodd=evenodd;
+    b.sink=&sink;
+  }
+
+  parallel(n,rasterizeBand,&bands[0]);
+}
+
+// Append the flattened cubic Bezier segment from z0 to z1, excluding z0.
+static void bezier(polyline& p, const pair& z0, const pair& c0,
+                   const pair& c1, const pair& z1, double tolerance,
+                   int depth=0)
+{
+  static const double third=1.0/3.0;
+  pair d=z1-z0;
+  if(depth >= 16 ||
+     (length(c0-z0-third*d) <= tolerance &&
+      length(c1-z1+third*d) <= tolerance)) {
+    p.push_back(z1);
+    return;
+  }
+  pair m0=0.5*(z0+c0), m1=0.5*(c0+c1), m2=0.5*(c1+z1);
+  pair m3=0.5*(m0+m1), m4=0.5*(m1+m2);
+  pair m=0.5*(m3+m4);
+  bezier(p,z0,m0,m3,m,tolerance,depth+1);
+  bezier(p,m,m4,m2,z1,tolerance,depth+1);
+}
+
+// Generates polygons in pen coordinates whose union is the outline of a
+// stroked path; they are mapped by T to device coordinates.
+class stroker {
+  std::vector<polyline>& out;
+  const transform& T;
+  double h;             // half of the pen width
+  Int cap,join;
+  double miterlimit;
+  double devscale;      // upper bound on device pixels per pen unit
+  double tolerance;     // maximum deviation in pixels of an arc
+
+  void polygon(const pair *z, size_t n) {
+    double area=0.0;
+    for(size_t i=0; i < n; ++i)
+      area += cross(z[i],z[i+1 < n ? i+1 : 0]);
+    if(area == 0.0) return;
+    polyline p(n);
+    for(size_t i=0; i < n; ++i)
+      p[i]=T*z[area > 0.0 ? i : n-1-i];
+    out.push_back(p);
+  }
+
+  void triangle(const pair& a, const pair& b, const pair& c) {
+    pair z[]={a,b,c};
+    polygon(z,3);
+  }
+
+  void quad(const pair& a, const pair& b, const pair& c, const pair& d) {
+    pair z[]={a,b,c,d};
+    polygon(z,4);
+  }
+
+  void circle(const pair& c) {
+    double r=h*devscale;
+    size_t n=r > tolerance ? (size_t) ceil(PI/acos(1.0-tolerance/r)) : 4;
+    n=std::min(std::max(n,(size_t) 4),(size_t) 256);
+    polyline z(n);
+    double step=2.0*PI/n;
+    for(size_t i=0; i < n; ++i)
+      z[i]=c+h*expi(i*step);
+    polygon(&z[0],n);
+  }
+
+  void square(const pair& c, const pair& d) {
+    pair n=h*pair(-d.gety(),d.getx());
+    pair e=h*d;
+    quad(c+n,c+n+e,c-n+e,c-n);
+  }
+
+  // Cap the end c of a segment with outward direction d.
+  void endcap(const pair& c, const pair& d) {
+    switch(cap) {
+      case 1: circle(c); break;
+      case 2: square(c,d); break;
+    }
+  }
+
+  void segment(const pair& a, const pair& b) {
+    pair d=unit(b-a);
+    pair n=h*pair(-d.gety(),d.getx());
+    quad(a+n,b+n,b-n,a-n);
+  }
+
+  // Join segments with unit directions d0 and d1 at v.
+  void vertex(const pair& v, const pair& d0, const pair& d1) {
+    double c=cross(d0,d1);
+    double cosine=dot(d0,d1);
+    if(c == 0.0 && cosine > 0.0) return;
+    pair o0=pair(-d0.gety(),d0.getx());
+    pair o1=pair(-d1.gety(),d1.getx());
+    if(c > 0.0) {o0=-o0; o1=-o1;}
+    switch(join) {
+      case 0:
+        if(cosine > -1.0 && 2.0 <= miterlimit*miterlimit*(1.0+cosine)) {
+          quad(v,v+h*o0,v+(h/(1.0+cosine))*(o0+o1),v+h*o1);
+          return;
+        }
+        break;
+      case 1: {
+        double theta=acos(std::max(std::min(cosine,1.0),-1.0));
+        if(h*devscale*theta*theta > 8.0*tolerance) {
+          circle(v);
+          return;
+        }
+        break;
+      }
+    }
+    triangle(v,v+h*o0,v+h*o1);
+  }
+
+public:
+  stroker(std::vector<polyline>& out, const transform& T, const pen& p,
+          double tolerance)
+    : out(out), T(T), h(0.5*p.width()), cap(p.cap()), join(p.join()),
+      miterlimit(p.miter()), tolerance(tolerance) {
+    devscale=sqrt(std::max(T.getxx()*T.getxx()+T.getyx()*T.getyx(),
+                           T.getxy()*T.getxy()+T.getyy()*T.getyy()));
+  }
+
+  // Stroke a polyline without dashes.
+  void solid(const polyline& P, bool closed) {
+    polyline q;
+    for(size_t i=0; i < P.size(); ++i)
+      if(q.empty() || P[i] != q.back()) q.push_back(P[i]);
+    if(closed && q.size() > 1 && q.front() == q.back()) q.pop_back();
+
+    size_t m=q.size();
+    if(m == 0 || h == 0.0) return;
+    if(m == 1) {
+      endcap(q[0],pair(1.0,0.0));
+      if(cap == 2) endcap(q[0],pair(-1.0,0.0));
+      return;
+    }
+
+    size_t nsegments=closed ? m : m-1;
+    std::vector<pair> d(nsegments);
+    for(size_t i=0; i < nsegments; ++i) {
+      const pair& a=q[i];
+      const pair& b=q[i+1 < m ? i+1 : 0];
+      segment(a,b);
+      d[i]=unit(b-a);
+    }
+
+    if(closed) {
+      for(size_t i=0; i < m; ++i)
+        vertex(q[i],d[i > 0 ? i-1 : m-1],d[i]);
+    } else {
+      for(size_t i=1; i+1 < m; ++i)
+        vertex(q[i],d[i-1],d[i]);
+      endcap(q[0],-d[0]);
+      endcap(q[m-1],d[m-2]);
+    }
+  }
+
+  // Stroke a polyline with the given dash pattern and offset.
+  void dashed(const polyline& P, bool closed,
+              const std::vector<double>& pattern, double offset) {
+    size_t n=pattern.size();
+    double sum=0.0;
+    for(size_t i=0; i < n; ++i)
+      sum += pattern[i];
+    if(sum <= 0.0) {
+      solid(P,closed);
+      return;
+    }
+
+    polyline q=P;
+    if(closed && !q.empty()) q.push_back(q[0]);
+    if(q.empty()) return;
+
+    double period=n % 2 ? 2.0*sum : sum;
+    double off=fmod(offset,period);
+    if(off < 0.0) off += period;
+    size_t index=0;
+    bool on=true;
+    double remaining=pattern[0];
+    while(off > remaining) {
+      off -= remaining;
+      index=(index+1) % n;
+      on=!on;
+      remaining=pattern[index];
+    }
+    remaining -= off;
+
+    polyline piece;
+    if(on) piece.push_back(q[0]);
+    for(size_t i=0; i+1 < q.size(); ++i) {
+      const pair& a=q[i];
+      const pair& b=q[i+1];
+      double L=length(b-a);
+      if(L == 0.0) continue;
+      double pos=0.0;
+      while(L-pos > remaining) {
+        pos += remaining;
+        pair z=a+(pos/L)*(b-a);
+        if(on) {
+          piece.push_back(z);
+          solid(piece,false);
+          piece.clear();
+        } else piece.assign(1,z);
+        on=!on;
+        index=(index+1) % n;
+        remaining=pattern[index];
+      }
+      remaining -= L-pos;
+      if(on) piece.push_back(b);
+    }
+    if(on && !piece.empty()) solid(piece,false);
+  }
+};
+
+pngfile::pngfile(const string& filename, double scale)
+  : scale(scale), width(0), height(0), supported(true)
+{
+  this->filename=filename;
+  pdfformat=false;
+  pdf=false;
+  transparency=false;
+  buffer=NULL;
+  out=&discard;
+}
+
+pngfile::~pngfile()
+{
+  for(size_t i=0; i < masks.size(); ++i)
+    delete masks[i];
+  out=NULL;
+}
+
+void pngfile::prologue(const bbox& box)
+{
+  this->box=box;
+  width=std::max((size_t) ceil((box.right-box.left)*scale),(size_t) 1);
+  height=std::max((size_t) ceil((box.top-box.bottom)*scale),(size_t) 1);
+  canvas.assign(4*width*height,0.0f);
+  current.T=transform(-box.left*scale,box.top*scale,scale,0.0,0.0,-scale);
+  resolution=scale;
+  linear=transform(0.0,0.0,scale,0.0,0.0,scale);
+  current.clips=0;
+  current.opacity=1.0;
+}
+
+static void put32(string& s, unsigned long n)
+{
+  for(int i=3; i >= 0; --i)
+    s += (char) ((n >> (8*i)) & 0xFF);
+}
+
+static void chunk(ostream& png, const char *type, const string& data)
+{
+  string s;
+  put32(s,data.size());
+  s += type;
+  s += data;
+  uLong crc=crc32(0L,Z_NULL,0);
+  crc=crc32(crc,(const Bytef *) s.data()+4,s.size()-4);
+  put32(s,crc);
+  png.write(s.data(),s.size());
+}
+
+void writePNG(ostream& png, size_t width, size_t height, int colortype,
+              const std::vector<unsigned char>& data)
+{
+  ostringstream compressed;
+  {
+    encodeFlate e(&compressed);
+    e.put(&data[0],data.size());
+    e.close();
+  }
+
+  png.write("\211PNG\r\n\032\n",8);
+  string header;
+  put32(header,width);
+  put32(header,height);
+  header += (char) 8;  // bit depth
+  header += (char) colortype;
+  header += (char) 0;  // deflate
+  header += (char) 0;  // adaptive filtering
+  header += (char) 0;  // no interlace
+  chunk(png,"IHDR",header);
+  chunk(png,"IDAT",compressed.str());
+  chunk(png,"IEND","");
+}
+
+void pngfile::epilogue()
+{
+  out=NULL;
+  if(!supported) return;
+
+  // Unpremultiply into filtered scanlines.
+  size_t rowbytes=4*width+1;
+  std::vector<unsigned char> data(rowbytes*height);
+  for(size_t y=0; y < height; ++y) {
+    unsigned char *row=&data[rowbytes*y];
+    *(row++)=0;
+    const float *p=&canvas[4*width*y];
+    for(size_t x=0; x < width; ++x, p += 4) {
+      float a=p[3];
+      float f=a > 0.0f ? 255.0f/a : 0.0f;
+      for(size_t i=0; i < 3; ++i)
+        *(row++)=(unsigned char) std::min(p[i]*f+0.5f,255.0f);
+      *(row++)=(unsigned char) std::min(a*255.0f+0.5f,255.0f);
+    }
+  }
+
+  ofstream png(filename.c_str(),std::ios::binary);
+  if(!png)
+    reportError("Cannot write to "+filename);
+
+  writePNG(png,width,height,6,data);
+
+  if(!png.good())
+    reportError("Cannot write to "+filename);
+}
+
+void pngfile::setopacity(const pen& p)
+{
+  string blend=p.blend();
+  if(blend != "Compatible" && blend != "Normal") unsupported();
+  current.opacity=p.opacity();
+  if(p.opacity() != 1.0) transparency=true;
+  lastpen.settransparency(p);
+}
+
+void pngfile::setpen(pen p)
+{
+  p.convert();
+  setopacity(p);
+  if(!p.fillpattern().empty()) unsupported();
+  lastpen=p;
+}
+
+void pngfile::gsave(bool)
+{
+  pens.push(lastpen);
+  states.push(current);
+  simplifystates.push(std::make_pair(tolerance,linear));
+}
+
+void pngfile::grestore(bool)
+{
+  if(states.size() < 1)
+    reportError("grestore without matching gsave");
+  lastpen=pens.top();
+  pens.pop();
+  current=states.top();
+  states.pop();
+  tolerance=simplifystates.top().first;
+  linear=simplifystates.top().second;
+  simplifystates.pop();
+  while(masks.size() > current.clips) {
+    delete masks.back();
+    masks.pop_back();
+  }
+}
+
+double pngfile::flattening()
+{
+  return std::max(flatness,tolerance*resolution);
+}
+
+void pngfile::newpath()
+{
+  subpaths.clear();
+  closed.clear();
+}
+
+void pngfile::moveto(pair z)
+{
+  subpaths.push_back(polyline(1,current.T*z));
+  closed.push_back(false);
+}
+
+void pngfile::lineto(pair z)
+{
+  if(subpaths.empty()) moveto(z);
+  else subpaths.back().push_back(current.T*z);
+}
+
+void pngfile::curveto(pair zp, pair zm, pair z1)
+{
+  if(subpaths.empty()) moveto(zp);
+  polyline& p=subpaths.back();
+  const transform& T=current.T;
+  bezier(p,p.back(),T*zp,T*zm,T*z1,flattening());
+}
+
+void pngfile::closepath()
+{
+  if(!closed.empty()) closed.back()=true;
+}
+
+void pngfile::addpath(rasterizer& r)
+{
+  for(size_t i=0; i < subpaths.size(); ++i)
+    r.add(subpaths[i]);
+}
+
+void pngfile::strokeoutline(const pen& p, rasterizer& r)
+{
+  const transform& T=current.T;
+  if(!T.invertible()) return;
+  transform Tinv=inverse(T);
+
+  std::vector<polyline> outline;
+  stroker s(outline,T,p,flattening());
+
+  const LineType *linetype=p.linetype();
+  size_t n=linetype->pattern.size();
+  std::vector<double> pattern(n);
+  for(size_t i=0; i < n; ++i)
+    pattern[i]=read<double>(linetype->pattern,i);
+
+  for(size_t i=0; i < subpaths.size(); ++i) {
+    const polyline& P=subpaths[i];
+    polyline q(P.size());
+    for(size_t j=0; j < P.size(); ++j)
+      q[j]=Tinv*P[j];
+    if(n > 0) s.dashed(q,closed[i],pattern,linetype->offset);
+    else s.solid(q,closed[i]);
+  }
+
+  for(size_t i=0; i < outline.size(); ++i)
+    r.add(outline[i]);
+  subpaths.swap(outline);
+  closed.assign(subpaths.size(),true);
+}
+
+void pngfile::paint(rasterizer *r, bool evenodd, const pngpainter& f)
+{
+  pngmask *mask=clip();
+  size_t y0=0, y1=height;
+  rasterizer R;
+  if(mask) {
+    y0=mask->y0;
+    y1=mask->y1;
+  }
+  if(!r) {
+    polyline box(4);
+    double x0=mask ? mask->x0 : 0, x1=mask ? mask->x1 : width;
+    box[0]=pair(x0,y0);
+    box[1]=pair(x1,y0);
+    box[2]=pair(x1,y1);
+    box[3]=pair(x0,y1);
+    R.add(box);
+    r=&R;
+    evenodd=false;
+  }
+  compositor sink(canvas,width,mask,f,current.opacity);
+  r->fill(width,y0,y1,evenodd,sink);
+}
+
+void pngfile::stroke(const pen& p, bool)
+{
+  rasterizer r;
+  strokeoutline(p,r);
+  paint(&r,false,solidpainter(p));
+  newpath();
+}
+
+void pngfile::strokepath()
+{
+  rasterizer r;
+  strokeoutline(lastpen,r);
+}
+
+void pngfile::fill(const pen& p)
+{
+  rasterizer r;
+  addpath(r);
+  paint(&r,p.evenodd(),solidpainter(p));
+  newpath();
+}
+
+void pngfile::endclip(const pen& p)
+{
+  rasterizer r;
+  addpath(r);
+  newpath();
+
+  pngmask *parent=clip();
+  pngmask *mask=new pngmask;
+  mask->a.assign(width*height,0);
+  mask->x0=(size_t) std::min(std::max(floor(r.xmin),0.0),(double) width);
+  mask->x1=(size_t) std::min(std::max(ceil(r.xmax),0.0),(double) width);
+  mask->y0=(size_t) std::min(std::max(floor(r.ymin),0.0),(double) height);
+  mask->y1=(size_t) std::min(std::max(ceil(r.ymax),0.0),(double) height);
+  if(parent) {
+    mask->x0=std::max(mask->x0,parent->x0);
+    mask->x1=std::min(mask->x1,parent->x1);
+    mask->y0=std::max(mask->y0,parent->y0);
+    mask->y1=std::min(mask->y1,parent->y1);
+  }
+  if(mask->x1 < mask->x0) mask->x1=mask->x0;
+  if(mask->y1 < mask->y0) mask->y1=mask->y0;
+
+  masker sink(mask,parent,width);
+  r.fill(width,mask->y0,mask->y1,p.evenodd(),sink);
+
+  masks.push_back(mask);
+  current.clips=masks.size();
+}
+
+void pngfile::latticeshade(const array& a, const transform& t)
+{
+  size_t n=a.size();
+  if(n == 0) return;
+
+  array *a0=read<array *>(a,0);
+  size_t m=a0->size();
+  if(m == 0) return;
+  setfirstopacity(*a0);
+
+  samplepainter f(current.T*t,m,n,true);
+  for(size_t i=0; i < n; ++i) {
+    array *ai=read<array *>(a,i);
+    if(checkArray(ai) != m) reportError("matrix is not rectangular");
+    for(size_t j=0; j < m; j++)
+      rgb(*read<pen *>(ai,j),f.sample(n-1-i,j));
+  }
+  paint(NULL,false,f);
+}
+
+void pngfile::gradientshade(bool axial, ColorSpace colorspace,
+                            const pen& pena, const pair& a, double ra,
+                            bool extenda, const pen& penb, const pair& b,
+                            double rb, bool extendb)
+{
+  setopacity(pena);
+  checkColorSpace(colorspace);
+  if(!current.T.invertible()) return;
+
+  if(axial)
+    paint(NULL,false,axialpainter(current.T,pena,a,extenda,penb,b,extendb));
+  else
+    paint(NULL,false,radialpainter(current.T,pena,a,ra,extenda,penb,b,rb,
+                                   extendb));
+}
+
+void pngfile::triangle(const pair *z, const float *c[3])
+{
+  double x0=z[0].getx(), y0=z[0].gety();
+  double ux=z[1].getx()-x0, uy=z[1].gety()-y0;
+  double vx=z[2].getx()-x0, vy=z[2].gety()-y0;
+  double det=ux*vy-vx*uy;
+  if(det == 0.0) return;
+  det=1.0/det;
+
+  double xmin=std::min(std::min(z[0].getx(),z[1].getx()),z[2].getx());
+  double xmax=std::max(std::max(z[0].getx(),z[1].getx()),z[2].getx());
+  double ymin=std::min(std::min(z[0].gety(),z[1].gety()),z[2].gety());
+  double ymax=std::max(std::max(z[0].gety(),z[1].gety()),z[2].gety());
+  size_t X0=(size_t) std::max(floor(xmin),0.0);
+  size_t X1=(size_t) std::min(std::max(ceil(xmax),0.0),(double) width);
+  size_t Y0=(size_t) std::max(floor(ymin),0.0);
+  size_t Y1=(size_t) std::min(std::max(ceil(ymax),0.0),(double) height);
+
+  const pngmask *mask=clip();
+  float opacity=current.opacity;
+  static const double epsilon=-1.0e-9;
+  for(size_t y=Y0; y < Y1; ++y) {
+    double py=y+0.5-y0;
+    for(size_t x=X0; x < X1; ++x) {
+      double px=x+0.5-x0;
+      double l1=(px*vy-vx*py)*det;
+      double l2=(ux*py-px*uy)*det;
+      double l0=1.0-l1-l2;
+      if(l0 < epsilon || l1 < epsilon || l2 < epsilon) continue;
+      float a=opacity;
+      if(mask) a *= mask->a[width*y+x]*(1.0f/255.0f);
+      if(a <= 0.0f) continue;
+      float C[3];
+      for(size_t i=0; i < 3; ++i)
+        C[i]=l0*c[0][i]+l1*c[1][i]+l2*c[2][i];
+      blend(&canvas[4*(width*y+x)],C,a);
+    }
+  }
+}
+
+void pngfile::gouraudshade(const pen& pentype, const array& pens,
+                           const array& vertices, const array& edges)
+{
+  size_t size=pens.size();
+  if(size == 0) return;
+
+  setfirstopacity(pens);
+  ColorSpace colorspace=maxcolorspace(pens);
+  checkColorSpace(colorspace);
+
+  std::vector<pair> z(size);
+  std::vector<float> c(3*size);
+  for(size_t i=0; i < size; i++) {
+    z[i]=current.T*read<pair>(vertices,i);
+    pen *p=read<pen *>(pens,i);
+    p->convert();
+    if(!p->promote(colorspace))
+      reportError(inconsistent);
+    rgb(*p,&c[3*i]);
+  }
+
+  // Decode the free-form triangle mesh edge flags.
+  size_t va=0, vb=0, vc=0;
+  for(size_t i=0; i < size;) {
+    Int flag=read<Int>(edges,i);
+    size_t t[3];
+    if(flag == 0 || i == 0) {
+      if(i+2 >= size) break;
+      va=t[0]=i; vb=t[1]=i+1; vc=t[2]=i+2;
+      i += 3;
+    } else {
+      t[0]=flag == 1 ? vb : va; t[1]=vc; t[2]=i;
+      if(flag == 1) va=vb;
+      vb=vc; vc=i;
+      ++i;
+    }
+    pair Z[]={z[t[0]],z[t[1]],z[t[2]]};
+    const float *C[]={&c[3*t[0]],&c[3*t[1]],&c[3*t[2]]};
+    triangle(Z,C);
+  }
+}
+
+// Render a tensor-product patch, with control points P in the order of a
+// PostScript type 7 shading and corner colors c, as a mesh of triangles.
+void pngfile::tensorpatch(const pair *P, const float *c[4])
+{
+  // Indices into P of the 4x4 control point matrix.
+  static const size_t index[4][4]={{0,1,2,3},{11,12,13,4},{10,15,14,5},
+                                   {9,8,7,6}};
+  pair Q[4][4];
+  bbox b;
+  for(size_t i=0; i < 4; ++i)
+    for(size_t j=0; j < 4; ++j) {
+      Q[i][j]=current.T*P[index[i][j]];
+      b += Q[i][j];
+    }
+
+  double size=std::max(b.right-b.left,b.top-b.bottom);
+  size_t N=std::min(std::max((size_t) ceil(0.25*size),(size_t) 1),
+                    (size_t) 64);
+
+  std::vector<pair> z((N+1)*(N+1));
+  std::vector<float> C(3*(N+1)*(N+1));
+  for(size_t k=0; k <= N; ++k) {
+    double u=(double) k/N;
+    double U[]={(1-u)*(1-u)*(1-u),3*u*(1-u)*(1-u),3*u*u*(1-u),u*u*u};
+    for(size_t l=0; l <= N; ++l) {
+      double v=(double) l/N;
+      double V[]={(1-v)*(1-v)*(1-v),3*v*(1-v)*(1-v),3*v*v*(1-v),v*v*v};
+      double x=0.0, y=0.0;
+      for(size_t i=0; i < 4; ++i)
+        for(size_t j=0; j < 4; ++j) {
+          double w=U[i]*V[j];
+          x += w*Q[i][j].getx();
+          y += w*Q[i][j].gety();
+        }
+      size_t n=(N+1)*k+l;
+      z[n]=pair(x,y);
+      for(size_t i=0; i < 3; ++i)
+        C[3*n+i]=(1-u)*((1-v)*c[0][i]+v*c[1][i])+u*(v*c[2][i]+(1-v)*c[3][i]);
+    }
+  }
+
+  for(size_t k=0; k < N; ++k)
+    for(size_t l=0; l < N; ++l) {
+      size_t n00=(N+1)*k+l, n01=n00+1, n10=n00+N+1, n11=n10+1;
+      pair Z0[]={z[n00],z[n10],z[n11]};
+      const float *C0[]={&C[3*n00],&C[3*n10],&C[3*n11]};
+      triangle(Z0,C0);
+      pair Z1[]={z[n00],z[n11],z[n01]};
+      const float *C1[]={&C[3*n00],&C[3*n11],&C[3*n01]};
+      triangle(Z1,C1);
+    }
+}
+
+void pngfile::tensorshade(const pen& pentype, const array& pens,
+                          const array& boundaries, const array& z)
+{
+  size_t size=pens.size();
+  if(size == 0) return;
+  size_t nz=z.size();
+
+  array *p0=read<array *>(pens,0);
+  if(checkArray(p0) != 4)
+    reportError("4 pens required");
+  setfirstopacity(*p0);
+
+  ColorSpace colorspace=maxcolorspace2(pens);
+  checkColorSpace(colorspace);
+
+  for(size_t i=0; i < size; i++) {
+    pair P[16];
+    path g=read<path>(boundaries,i);
+    if(!(g.cyclic() && g.size() == 4))
+      reportError("specify cyclic path of length 4");
+    size_t k=0;
+    for(Int j=4; j > 0; --j) {
+      P[k++]=g.point(j);
+      P[k++]=g.precontrol(j);
+      P[k++]=g.postcontrol(j-1);
+    }
+    if(nz == 0) { // Coons patch
+      static double nineth=1.0/9.0;
+      for(Int j=0; j < 4; ++j) {
+        P[k++]=nineth*(-4.0*g.point(j)+6.0*(g.precontrol(j)+
+                                             g.postcontrol(j))
+                       -2.0*(g.point(j-1)+g.point(j+1))
+                       +3.0*(g.precontrol(j-1)+g.postcontrol(j+1))
+                       -g.point(j+2));
+      }
+    } else {
+      array *zi=read<array *>(z,i);
+      if(checkArray(zi) != 4)
+        reportError("specify 4 internal control points for each path");
+      P[k++]=read<pair>(zi,0);
+      P[k++]=read<pair>(zi,3);
+      P[k++]=read<pair>(zi,2);
+      P[k++]=read<pair>(zi,1);
+    }
+
+    array *pi=read<array *>(pens,i);
+    if(checkArray(pi) != 4)
+      reportError("specify 4 pens for each path");
+    float c[4][3];
+    static const size_t order[]={0,3,2,1};
+    for(size_t j=0; j < 4; ++j) {
+      pen *p=read<pen *>(pi,order[j]);
+      p->convert();
+      if(!p->promote(colorspace))
+        reportError(inconsistent);
+      rgb(*p,c[j]);
+    }
+    const float *C[]={c[0],c[1],c[2],c[3]};
+    tensorpatch(P,C);
+  }
+}
+
+void pngfile::imageheader(size_t width, size_t height, ColorSpace colorspace)
+{
+  imagewidth=width;
+  imageheight=height;
+  imagecolorspace=colorspace;
+}
+
+encoder *pngfile::newencoder()
+{
+  imagedata.clear();
+  imagedata.reserve(ColorComponents[imagecolorspace]*imagewidth*imageheight);
+  return new collect(imagedata);
+}
+
+void pngfile::outImage()
+{
+  size_t ncomponents=ColorComponents[imagecolorspace];
+  std::vector<unsigned char> data;
+  data.swap(imagedata);
+  if(!current.T.invertible()) return;
+
+  size_t m=imagewidth, n=imageheight;
+  samplepainter f(current.T,m,n,false);
+  const unsigned char *b=&data[0];
+  for(size_t i=0; i < n; ++i)
+    for(size_t j=0; j < m; ++j, b += ncomponents) {
+      float *c=f.sample(i,j);
+      switch(ncomponents) {
+        case 1:
+          c[0]=c[1]=c[2]=b[0]/255.0f;
+          break;
+        case 3:
+          for(size_t k=0; k < 3; ++k)
+            c[k]=b[k]/255.0f;
+          break;
+        case 4: {
+          float k=1.0f-b[3]/255.0f;
+          for(size_t l=0; l < 3; ++l)
+            c[l]=(1.0f-b[l]/255.0f)*k;
+          break;
+        }
+      }
+    }
+
+  rasterizer r;
+  polyline square(4);
+  square[0]=current.T*pair(0,0);
+  square[1]=current.T*pair(1,0);
+  square[2]=current.T*pair(1,1);
+  square[3]=current.T*pair(0,1);
+  r.add(square);
+  paint(&r,false,f);
+}
+
+} //namespace camp
@@ -0,0 +1,133 @@
+/*****
+ * pngfile.h
+ *
+ * Rasterizes pictures without labels directly to a PNG file.
+ *****/
+
+#ifndef PNGFILE_H
+#define PNGFILE_H
+
+#include <vector>
+
+#include "psfile.h"
+
+namespace camp {
+
+typedef std::vector<pair> polyline;
+
+struct pngmask;
+class pngpainter;
+class rasterizer;
+
+// Write an 8-bit PNG image of the given color type (0=gray, 2=RGB, 6=RGBA)
+// to s, given its scanlines, each preceded by a filter type byte.
+void writePNG(ostream& s, size_t width, size_t height, int colortype,
+              const std::vector<unsigned char>& data);
+
+class pngfile : public psfile {
+  struct state {
+    transform T;        // maps user to device coordinates
+    size_t clips;       // number of active clipping masks
+    double opacity;
+  };
+
+  ostringstream discard;
+  bbox box;
+  double scale;         // device pixels per PostScript point
+  size_t width,height;
+  bool supported;
+
+  std::vector<float> canvas;  // premultiplied RGBA
+  std::vector<pngmask *> masks;
+  state current;
+  mem::stack<state> states;
+
+  // The current path, flattened to device coordinates.
+  std::vector<polyline> subpaths;
+  std::vector<bool> closed;
+
+  size_t imagewidth,imageheight;
+  ColorSpace imagecolorspace;
+  std::vector<unsigned char> imagedata;
+
+  pngmask *clip() {
+    return current.clips > 0 ? masks[current.clips-1] : NULL;
+  }
+
+  // The maximum deviation in pixels of flattened curves and arcs.
+  double flattening();
+
+  void addpath(rasterizer& r);
+  void strokeoutline(const pen& p, rasterizer& r);
+
+  // Paint the region covered by the rasterized polygons (or the current
+  // clipping region, if r is NULL) with the painter f.
+  void paint(rasterizer *r, bool evenodd, const pngpainter& f);
+
+  // Paint a triangle with vertex colors c (RGB triples) at device
+  // points z, unblended at the edges.
+  void triangle(const pair *z, const float *c[3]);
+
+  void tensorpatch(const pair *P, const float *c[4]);
+
+public:
+  pngfile(const string& filename, double scale);
+  ~pngfile();
+
+  // Could every element be rasterized directly?
+  bool Supported() {return supported;}
+
+  void unsupported() {supported=false;}
+
+  void prologue(const bbox& box);
+  void epilogue();
+
+  void setpen(pen p);
+  void setopacity(const pen& p);
+
+  void newpath();
+  void moveto(pair z);
+  void lineto(pair z);
+  void curveto(pair zp, pair zm, pair z1);
+  void closepath();
+
+  void stroke(const pen &p, bool dot=false);
+  void strokepath();
+  void fill(const pen &p);
+
+  void beginclip() {newpath();}
+  void endclip(const pen &p);
+
+  void latticeshade(const vm::array& a, const transform& t);
+  void gradientshade(bool axial, ColorSpace colorspace,
+                     const pen& pena, const pair& a, double ra,
+                     bool extenda, const pen& penb, const pair& b,
+                     double rb, bool extendb);
+  void gouraudshade(const pen& pentype, const vm::array& pens,
+                    const vm::array& vertices, const vm::array& edges);
+  void tensorshade(const pen& pentype, const vm::array& pens,
+                   const vm::array& boundaries, const vm::array& z);
+
+  void imageheader(size_t width, size_t height, ColorSpace colorspace);
+  encoder *newencoder();
+  void outImage();
+
+  void gsave(bool tex=false);
+  void grestore(bool tex=false);
+
+  void translate(pair z) {
+    current.T=current.T*shift(z);
+  }
+
+  void concat(transform t) {
+    current.T=current.T*t;
+    linear=linear*shiftless(t);
+  }
+
+  void verbatimline(const string&) {unsupported();}
+  void verbatim(const string&) {unsupported();}
+};
+
+} //namespace camp
+
+#endif
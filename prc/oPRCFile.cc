@@ -28,6 +28,10 @@
 #include <cstring>
 #include <zlib.h>
 
+#ifdef HAVE_PTHREAD
+#include <pthread.h>
+#endif
+
 namespace prc {
 
 #define WriteUnsignedInteger( value ) out << (uint32_t)(value);
@@ -68,7 +72,6 @@ namespace prc {
     WriteUncompressedBlock ((*it)->data, (*it)->file_size) \
   } \
  }
-#define SerializeModelFileData serializeModelFileData(modelFile_out); modelFile_out.compress();
 #define SerializeUnit( value ) (value).serializeUnit(out);
 
 using namespace std;
@@ -308,13 +311,87 @@ void PRCFileStructure::write(ostream &out)
   extraGeometry_out.write(out);
 }
 
-#define SerializeFileStructureGlobals serializeFileStructureGlobals(globals_out); globals_out.compress(); sizes[1]=globals_out.getSize();
-#define SerializeFileStructureTree serializeFileStructureTree(tree_out); tree_out.compress(); sizes[2]=tree_out.getSize();
-#define SerializeFileStructureTessellation serializeFileStructureTessellation(tessellations_out); tessellations_out.compress(); sizes[3]=tessellations_out.getSize();
-#define SerializeFileStructureGeometry serializeFileStructureGeometry(geometry_out); geometry_out.compress(); sizes[4]=geometry_out.getSize();
-#define SerializeFileStructureExtraGeometry serializeFileStructureExtraGeometry(extraGeometry_out); extraGeometry_out.compress(); sizes[5]=extraGeometry_out.getSize();
+// FNV-1a hash of serialized content.
+static uint32_t contentHash(const std::string& content)
+{
+  uint32_t hash = 2166136261u;
+  for(size_t i=0; i < content.size(); ++i)
+  {
+    hash ^= (uint8_t) content[i];
+    hash *= 16777619u;
+  }
+  return hash;
+}
+
+// The uncompressed serialization of a tessellation, used to detect
+// duplicate meshes.
+static std::string serializedTess(PRCTess *tess)
+{
+  uint8_t *buffer = NULL;
+  std::string content;
+  {
+    PRCbitStream out(buffer,0u);
+    tess->serializeBaseTessData(out);
+    content.assign((const char *) buffer,out.getSize());
+  }
+  free(buffer);
+  return content;
+}
+
+// The uncompressed serialization of a face's base surface, used to share
+// one body among transformed instances of the same surface.
+static std::string serializedSurface(PRCSurface *surface)
+{
+  uint8_t *buffer = NULL;
+  std::string content;
+  {
+    PRCbitStream out(buffer,0u);
+    surface->serializeSurface(out);
+    content.assign((const char *) buffer,out.getSize());
+  }
+  free(buffer);
+  resetGraphicsAndName();
+  return content;
+}
+
+#ifdef HAVE_PTHREAD
+static void *compressStream(void *stream)
+{
+  ((PRCbitStream *) stream)->compress();
+  return NULL;
+}
+#endif
+
+// Deflate independent bit streams concurrently. Serialization itself must
+// remain sequential since the writers share the current graphics and name
+// state; only the zlib pass, which dominates for large models, is threaded.
+void compressStreams(PRCbitStream *streams[], size_t n)
+{
+#ifdef HAVE_PTHREAD
+  std::vector<pthread_t> threads(n);
+  std::vector<bool> started(n,false);
+  for(size_t i=1; i < n; ++i)
+    started[i]=pthread_create(&threads[i],NULL,compressStream,streams[i]) == 0;
+  if(n > 0) streams[0]->compress();
+  for(size_t i=1; i < n; ++i) {
+    if(started[i]) pthread_join(threads[i],NULL);
+    else streams[i]->compress();
+  }
+#else
+  for(size_t i=0; i < n; ++i)
+    streams[i]->compress();
+#endif
+}
+
+#define SerializeFileStructureGlobals serializeFileStructureGlobals(globals_out);
+#define SerializeFileStructureTree serializeFileStructureTree(tree_out);
+#define SerializeFileStructureTessellation serializeFileStructureTessellation(tessellations_out);
+#define SerializeFileStructureGeometry serializeFileStructureGeometry(geometry_out);
+#define SerializeFileStructureExtraGeometry serializeFileStructureExtraGeometry(extraGeometry_out);
 #define FlushSerialization resetGraphicsAndName();
-void PRCFileStructure::prepare()
+
+// Serialize the file structure sections without compressing them.
+void PRCFileStructure::serialize()
 {
   uint32_t size = 0;
   size += getStartHeaderSize();
@@ -339,6 +416,26 @@ void PRCFileStructure::prepare()
   FlushSerialization
 }
 
+// Record the compressed section sizes; the sections must have been
+// serialized and compressed.
+void PRCFileStructure::finalizeSizes()
+{
+  sizes[1]=globals_out.getSize();
+  sizes[2]=tree_out.getSize();
+  sizes[3]=tessellations_out.getSize();
+  sizes[4]=geometry_out.getSize();
+  sizes[5]=extraGeometry_out.getSize();
+}
+
+void PRCFileStructure::prepare()
+{
+  serialize();
+  PRCbitStream *streams[]={&globals_out,&tree_out,&tessellations_out,
+                           &geometry_out,&extraGeometry_out};
+  compressStreams(streams,5);
+  finalizeSizes();
+}
+
 uint32_t PRCFileStructure::getSize()
 {
   uint32_t size = 0;
@@ -734,12 +831,7 @@ void oPRCFile::doGroup(PRCgroup& group)
           break;
         }
       PRCTopoContext *context = NULL;
-      const uint32_t context_index = getTopoContext(context);
-      context->granularity = group.options.granularity;
-   // Acrobat 9 also does the following:
-   // context->tolerance = group.options.granularity;
-   // context->have_smallest_face_thickness = true;
-   // context->smallest_thickness = group.options.granularity;
+      uint32_t context_index = m1;
       PRCShell *shell = new PRCShell;
 
       for(PRCfaceList::iterator fit=faces.begin(); fit!=faces.end(); fit++)
@@ -747,17 +839,48 @@ void oPRCFile::doGroup(PRCgroup& group)
         if(fit->transform || group.options.do_break ||
            (fit->transparent && !group.options.no_break))
         {
-          PRCShell *shell = new PRCShell;
-          shell->addFace(fit->face);
-          PRCConnex *connex = new PRCConnex;
-          connex->addShell(shell);
-          PRCBrepData *body = new PRCBrepData;
-          body->addConnex(connex);
-          const uint32_t body_index = context->addBrepData(body);
+          // Transformed copies of an identical surface (e.g. spheres used
+          // as markers) reference a single body.
+          std::string key;
+          PRCsurfaceMap::const_iterator pSurface = surfaceMap.end();
+          if(fit->transform && fit->face->base_surface)
+          {
+            key = serializedSurface(fit->face->base_surface);
+            pSurface = surfaceMap.find(key);
+          }
+          uint32_t body_context_index, body_index;
+          if(pSurface!=surfaceMap.end())
+          {
+            delete fit->face;
+            body_context_index = pSurface->second.first;
+            body_index = pSurface->second.second;
+          }
+          else
+          {
+            PRCShell *shell = new PRCShell;
+            shell->addFace(fit->face);
+            PRCConnex *connex = new PRCConnex;
+            connex->addShell(shell);
+            PRCBrepData *body = new PRCBrepData;
+            body->addConnex(connex);
+            if(context == NULL)
+            {
+              context_index = getTopoContext(context);
+              context->granularity = group.options.granularity;
+            // Acrobat 9 also does the following:
+            // context->tolerance = group.options.granularity;
+            // context->have_smallest_face_thickness = true;
+            // context->smallest_thickness = group.options.granularity;
+            }
+            body_context_index = context_index;
+            body_index = context->addBrepData(body);
+            if(!key.empty())
+              surfaceMap.insert(make_pair(key,make_pair(context_index,body_index)));
+          }
 
           PRCBrepModel *brepmodel = new PRCBrepModel();
           brepmodel->index_of_line_style = fit->style;
-          brepmodel->context_id = context_index;
+          brepmodel->context_id = body_context_index;
           brepmodel->body_id = body_index;
           brepmodel->is_closed = group.options.closed;
 
@@ -782,6 +905,15 @@ void oPRCFile::doGroup(PRCgroup& group)
         connex->addShell(shell);
         PRCBrepData *body = new PRCBrepData;
         body->addConnex(connex);
+        if(context == NULL)
+        {
+          context_index = getTopoContext(context);
+          context->granularity = group.options.granularity;
+        // Acrobat 9 also does the following:
+        // context->tolerance = group.options.granularity;
+        // context->have_smallest_face_thickness = true;
+        // context->smallest_thickness = group.options.granularity;
+        }
         const uint32_t body_index = context->addBrepData(body);
         PRCBrepModel *brepmodel = new PRCBrepModel();
         if(same_color)
@@ -993,9 +1125,16 @@ bool oPRCFile::finish()
   }
   doGroup(groups.top());
 
-  // write each section's bit data
-  fileStructures[0]->prepare();
-  SerializeModelFileData
+  // serialize each section's bit data, then compress all of the
+  // independent sections, including the model file, concurrently
+  PRCFileStructure *fs=fileStructures[0];
+  fs->serialize();
+  serializeModelFileData(modelFile_out);
+  PRCbitStream *streams[]={&fs->globals_out,&fs->tree_out,
+                           &fs->tessellations_out,&fs->geometry_out,
+                           &fs->extraGeometry_out,&modelFile_out};
+  compressStreams(streams,6);
+  fs->finalizeSizes();
 
   // create the header
 
@@ -1862,18 +2001,38 @@ uint32_t PRCFileStructure::getTopoContext(PRCTopoContext*& pTopoContext)
   return contexts.size()-1;
 }
 
+// Add a tessellation, reusing an earlier tessellation with identical
+// content; pTess is deleted in that case.
+uint32_t PRCFileStructure::addTessUnique(PRCTess* pTess)
+{
+  const std::string content = serializedTess(pTess);
+  const uint32_t hash = contentHash(content);
+  for(PRCtessMap::const_iterator it=tessMap.lower_bound(hash); it!=tessMap.end() && it->first==hash; ++it)
+  {
+    if(serializedTess(tessellations[it->second]) == content)
+    {
+      delete pTess;
+      return it->second;
+    }
+  }
+  tessellations.push_back(pTess);
+  const uint32_t tess_index = tessellations.size()-1;
+  tessMap.insert(make_pair(hash,tess_index));
+  return tess_index;
+}
+
 uint32_t PRCFileStructure::add3DTess(PRC3DTess*& p3DTess)
 {
-  tessellations.push_back(p3DTess);
+  const uint32_t tess_index = addTessUnique(p3DTess);
   p3DTess = NULL;
-  return tessellations.size()-1;
+  return tess_index;
 }
 
 uint32_t PRCFileStructure::add3DWireTess(PRC3DWireTess*& p3DWireTess)
 {
-  tessellations.push_back(p3DWireTess);
+  const uint32_t tess_index = addTessUnique(p3DWireTess);
   p3DWireTess = NULL;
-  return tessellations.size()-1;
+  return tess_index;
 }
 /*
 uint32_t PRCFileStructure::addMarkupTess(PRCMarkupTess*& pMarkupTess)
@@ -514,6 +514,9 @@ class PRCStartHeader
     uint32_t getStartHeaderSize() const;
 };
 
+// content hash -> tessellation index
+typedef std::multimap <uint32_t,uint32_t> PRCtessMap;
+
 class PRCFileStructure : public PRCStartHeader
 {
   public:
@@ -536,6 +539,7 @@ class PRCFileStructure : public PRCStartHeader
     double unit;
     PRCTopoContextList contexts;
     PRCTessList tessellations;
+    PRCtessMap tessMap;
 
     uint32_t sizes[6];
     uint8_t *globals_data;
@@ -579,6 +583,8 @@ class PRCFileStructure : public PRCStartHeader
       geometry_data(NULL),geometry_out(geometry_data,0),
       extraGeometry_data(NULL),extraGeometry_out(extraGeometry_data,0) {}
     void write(std::ostream&);
+    void serialize();
+    void finalizeSizes();
     void prepare();
     uint32_t getSize();
     void serializeFileStructureGlobals(PRCbitStream&);
@@ -597,6 +603,7 @@ class PRCFileStructure : public PRCStartHeader
     uint32_t addProductOccurrence(PRCProductOccurrence*& pProductOccurrence);
     uint32_t addTopoContext(PRCTopoContext*& pTopoContext);
     uint32_t getTopoContext(PRCTopoContext*& pTopoContext);
+    uint32_t addTessUnique(PRCTess* pTess);
     uint32_t add3DTess(PRC3DTess*& p3DTess);
     uint32_t add3DWireTess(PRC3DWireTess*& p3DWireTess);
 /*
@@ -608,6 +615,8 @@ class PRCFileStructure : public PRCStartHeader
     uint32_t addCoordinateSystemUnique(PRCCoordinateSystem*& pCoordinateSystem);
 };
 
+void compressStreams(PRCbitStream *streams[], size_t n);
+
 class PRCFileStructureInformation
 {
   public:
@@ -635,6 +644,8 @@ class PRCHeader : public PRCStartHeader
 };
 
 typedef std::map <PRCGeneralTransformation3d,uint32_t> PRCtransformMap;
+// serialized surface -> (context index, body index)
+typedef std::map <std::string,std::pair<uint32_t,uint32_t> > PRCsurfaceMap;
 
 inline double X(const double *v) {return v[0];}
 inline double Y(const double *v) {return v[1];}
@@ -737,6 +748,7 @@ class oPRCFile
     PRCpictureMap pictureMap;
     PRCgroup rootGroup;
     PRCtransformMap transformMap;
+    PRCsurfaceMap surfaceMap;
     std::stack<PRCgroup> groups;
     PRCgroup& findGroup();
     void doGroup(PRCgroup& group);
@@ -6,12 +6,16 @@
  * Allows identification and removal of redundant commands.
  *****/
 
+#include <algorithm>
+#include <cstring>
 #include <ctime>
 #include <iomanip>
 #include <sstream>
+#include <vector>
 #include <zlib.h>
 
 #include "psfile.h"
+#include "util.h"
 #include "settings.h"
 #include "errormsg.h"
 #include "array.h"
@@ -43,7 +47,9 @@ void checkColorSpace(ColorSpace colorspace)
     
 psfile::psfile(const string& filename, bool pdfformat)
   : filename(filename), pdfformat(pdfformat), pdf(false),
-    transparency(false), buffer(NULL), out(NULL) 
+    transparency(false), tolerance(settings::getSetting<double>("simplify")),
+    resolution(1.0),
+    buffer(NULL), imageencoder(NULL), out(NULL) 
 {
   if(filename.empty()) out=&cout;
   else out=new ofstream(filename.c_str());
@@ -105,17 +111,111 @@ void psfile::dealias(unsigned char *a, size_t width, size_t height, size_t n,
   }
 }
 
-void psfile::writeCompressed(const unsigned char *a, size_t size)
-{  
-  uLongf compressedSize=compressBound(size);
-  Bytef *compressed=new Bytef[compressedSize];
-  
-  if(compress(compressed,&compressedSize,a,size) != Z_OK)
-    reportError("image compression failed");
+encodeFlate::encodeFlate(ostream *out, encoder *next)
+  : out(out), next(next), closed(false)
+{
+  z.zalloc=Z_NULL;
+  z.zfree=Z_NULL;
+  z.opaque=Z_NULL;
+  if(deflateInit(&z,Z_DEFAULT_COMPRESSION) != Z_OK)
+    reportError("compression failed");
+}
+
+encodeFlate::~encodeFlate()
+{
+  deflateEnd(&z);
+  delete next;
+}
 
-  encode85 e(out);
-  for(size_t i=0; i < compressedSize; ++i)
-    e.put(compressed[i]);
+void encodeFlate::close()
+{
+  if(closed) return;
+  closed=true;
+  z.next_in=Z_NULL;
+  z.avail_in=0;
+  deflate(Z_FINISH);
+  if(next) next->close();
+}
+
+void encodeFlate::deflate(int flush)
+{
+  do {
+    z.next_out=output;
+    z.avail_out=chunk;
+    if(::deflate(&z,flush) == Z_STREAM_ERROR)
+      reportError("compression failed");
+    size_t n=chunk-z.avail_out;
+    if(next) next->put(output,n);
+    else out->write((const char *) output,n);
+  } while(z.avail_out == 0);
+}
+
+void encodeFlate::put(const unsigned char *a, size_t n)
+{
+  z.next_in=(Bytef *) a;
+  z.avail_in=n;
+  deflate(Z_NO_FLUSH);
+}
+
+void psfile::beginImage(size_t width, size_t height, size_t ncomponents,
+                        bool antialias)
+{
+  static const size_t blocksize=65536;
+  pixelsize=ncomponents;
+  rowsize=ncomponents*width;
+  rows=height;
+  this->antialias=antialias;
+  // Dealiasing a row needs the following one, so buffer at least two rows.
+  size_t blockrows=std::max(blocksize/rowsize,(size_t) 2);
+  buffersize=rowsize*std::min(blockrows,height);
+  buffer=new unsigned char[buffersize];
+  count=0;
+  imageencoder=newencoder();
+}
+
+void psfile::flushImage()
+{
+  size_t n=count/rowsize;
+  if(n == 0) return;
+  if(antialias) dealias(buffer,rowsize/pixelsize,n,pixelsize);
+  // Unless it is the last row of the image, the last buffered row can only
+  // be dealiased once the following row is available.
+  size_t done=(antialias && n < rows) ? n-1 : n;
+  imageencoder->put(buffer,rowsize*done);
+  rows -= done;
+  count -= rowsize*done;
+  if(count > 0) memmove(buffer,buffer+rowsize*done,count);
+}
+
+void psfile::endImage()
+{
+  flushImage();
+  imageencoder->close();
+  delete imageencoder;
+  imageencoder=NULL;
+  delete[] buffer;
+  buffer=NULL;
+  outImage();
+}
+
+void psfile::writeBytes(const unsigned char *a, size_t n)
+{
+  while(n > 0) {
+    size_t m=std::min(n,buffersize-count);
+    memcpy(buffer+count,a,m);
+    count += m;
+    a += m;
+    n -= m;
+    if(count == buffersize) flushImage();
+  }
+}
+
+encoder *psfile::newencoder()
+{
+  encode85 *e=new encode85(out);
+  if(settings::getSetting<Int>("level") >= 3)
+    return new encodeFlate(out,e);
+  return e;
 }
   
 void psfile::close()
@@ -264,6 +364,45 @@ void psfile::write(const pen& p)
     *out << p.gray();
 }
   
+// Douglas-Peucker simplification: mark the interior nodes of the straight
+// run of path p from node first to node last that can be omitted without
+// moving the run more than tolerance, once mapped to the device by the
+// linear transformation t.
+static void simplify(const path& p, Int first, Int last, double tolerance,
+                     const transform& t, std::vector<bool>& keep)
+{
+  std::vector<std::pair<Int,Int> > runs;
+  runs.push_back(std::make_pair(first,last));
+  while(!runs.empty()) {
+    Int a=runs.back().first;
+    Int b=runs.back().second;
+    runs.pop_back();
+    if(b-a < 2) continue;
+    pair A=t*p.point(a);
+    pair d=t*p.point(b)-A;
+    double d2=d.abs2();
+    double max=0.0;
+    Int k=a;
+    for(Int i=a+1; i < b; ++i) {
+      pair v=t*p.point(i)-A;
+      // Distance to the segment, which catches runs that double back.
+      double t=d2 > 0.0 ? dot(v,d)/d2 : 0.0;
+      double dist=length(v-(t < 0.0 ? 0.0 : t > 1.0 ? 1.0 : t)*d);
+      if(dist > max) {
+        max=dist;
+        k=i;
+      }
+    }
+    if(max > tolerance) {
+      runs.push_back(std::make_pair(a,k));
+      runs.push_back(std::make_pair(k,b));
+    } else {
+      for(Int i=a+1; i < b; ++i)
+        keep[i]=false;
+    }
+  }
+}
+
 void psfile::write(path p, bool newPath)
 {
   Int n = p.size();
@@ -273,12 +412,24 @@ void psfile::write(path p, bool newPath)
 
   pair z0=p.point((Int) 0);
 
+  std::vector<bool> keep;
+  if(tolerance > 0.0 && n > 2) {
+    keep.resize(n,true);
+    for(Int i=0; i < n-1;) {
+      Int j=i;
+      while(j < n-1 && p.straight(j)) ++j;
+      if(j-i >= 2) simplify(p,i,j,tolerance*resolution,linear,keep);
+      i=std::max(j,i+1);
+    }
+  }
+  
   // Draw points
   moveto(z0);
   
   for(Int i = 1; i < n; i++) {
-    if(p.straight(i-1)) lineto(p.point(i));
-    else curveto(p.postcontrol(i-1),p.precontrol(i),p.point(i));
+    if(p.straight(i-1)) {
+      if(keep.empty() || keep[i]) lineto(p.point(i));
+    } else curveto(p.postcontrol(i-1),p.precontrol(i),p.point(i));
   }
 
   if(p.cyclic()) {
@@ -493,24 +644,25 @@ void psfile::tensorshade(const pen& pentype, const array& pens,
        << "shfill" << newl;
 }
  
-void psfile::write(pen *p, size_t ncomponents) 
+// Store the ncomponents color bytes of pen p in b.
+void psfile::penbytes(pen *p, unsigned char *b, size_t ncomponents)
 {
   switch(ncomponents) {
     case 0:
       break;
     case 1: 
-      writeByte(byte(p->gray())); 
+      b[0]=byte(p->gray()); 
       break;
     case 3:
-      writeByte(byte(p->red())); 
-      writeByte(byte(p->green())); 
-      writeByte(byte(p->blue())); 
+      b[0]=byte(p->red()); 
+      b[1]=byte(p->green()); 
+      b[2]=byte(p->blue()); 
       break;
     case 4:
-      writeByte(byte(p->cyan())); 
-      writeByte(byte(p->magenta())); 
-      writeByte(byte(p->yellow())); 
-      writeByte(byte(p->black())); 
+      b[0]=byte(p->cyan()); 
+      b[1]=byte(p->magenta()); 
+      b[2]=byte(p->yellow()); 
+      b[3]=byte(p->black()); 
     default:
       break;
   }
@@ -545,6 +697,40 @@ void psfile::imageheader(size_t width, size_t height, ColorSpace colorspace)
        << "image" << newl;
 }
 
+// Rows [i0,i1) of real-valued image data to be mapped through a palette.
+struct paletteband {
+  const array *a;
+  const unsigned char *table;  // color bytes of each palette entry
+  size_t Psize,ncomponents,width;
+  double min,step;
+  unsigned char *buffer;        // destination of row first
+  size_t first,i0,i1;
+};
+
+static void mappalette(const paletteband& b)
+{
+  size_t n=b.ncomponents;
+  for(size_t i=b.i0; i < b.i1; ++i) {
+    array *ai=read<array *>(b.a,i);
+    unsigned char *dest=b.buffer+n*b.width*(i-b.first);
+    for(size_t j=0; j < b.width; ++j) {
+      double val=read<double>(ai,j);
+      size_t index=(size_t) ((val-b.min)*b.step+0.5);
+      const unsigned char *src=b.table+n*(index < b.Psize ? index : b.Psize-1);
+      for(size_t k=0; k < n; ++k)
+        *(dest++)=src[k];
+    }
+  }
+}
+
+static void mapBand(void *bands, size_t k)
+{
+  mappalette(((paletteband *) bands)[k]);
+}
+
+// The smallest number of pixels worth mapping on a thread of its own.
+static const size_t bandpixels=65536;
+
 void psfile::image(const array& a, const array& P, bool antialias)
 {
   size_t asize=a.size();
@@ -580,20 +766,49 @@ void psfile::image(const array& a, const array& P, bool antialias)
   
   double step=(max == min) ? 0.0 : (Psize-1)/(max-min);
   
-  beginImage(ncomponents*a0size*asize);
-  for(size_t i=0; i < asize; i++) {
-    array *ai=read<array *>(a,i);
-    for(size_t j=0; j < a0size; j++) {
-      double val=read<double>(ai,j);
-      size_t index=(size_t) ((val-min)*step+0.5);
-      pen *p=read<pen *>(P,index < Psize ? index : Psize-1);
-      p->convert();
-      if(!p->promote(colorspace))
-        reportError(inconsistent);
-      write(p,ncomponents);
+  // Convert each palette entry once and map the data through the table.
+  unsigned char *table=new unsigned char[ncomponents*Psize];
+  for(size_t k=0; k < Psize; ++k) {
+    pen *p=read<pen *>(P,k);
+    p->convert();
+    if(!p->promote(colorspace))
+      reportError(inconsistent);
+    penbytes(p,table+ncomponents*k,ncomponents);
+  }
+  
+  beginImage(a0size,asize,ncomponents,antialias);
+  
+  size_t nthreads=threadcount(a0size*asize,bandpixels);
+  std::vector<paletteband> bands(nthreads);
+  
+  // Map each block of rows that fits in the image buffer.
+  for(size_t first=0; first < asize;) {
+    size_t nrows=std::min((buffersize-count)/rowsize,asize-first);
+    size_t n=std::min(nthreads,nrows);
+    for(size_t k=0; k < n; ++k) {
+      paletteband& b=bands[k];
+      b.a=&a;
+      b.table=table;
+      b.Psize=Psize;
+      b.ncomponents=ncomponents;
+      b.width=a0size;
+      b.min=min;
+      b.step=step;
+      b.buffer=buffer+count;
+      b.first=first;
+      b.i0=first+nrows*k/n;
+      b.i1=first+nrows*(k+1)/n;
     }
+  
+    parallel(n,mapBand,&bands[0]);
+    
+    first += nrows;
+    count += rowsize*nrows;
+    if(count == buffersize) flushImage();
   }
-  endImage(antialias,a0size,asize,ncomponents);
+  
+  delete[] table;
+  endImage();
 }
 
 void psfile::image(const array& a, bool antialias)
@@ -614,7 +829,7 @@ void psfile::image(const array& a, bool antialias)
   
   imageheader(a0size,asize,colorspace);
     
-  beginImage(ncomponents*a0size*asize);
+  beginImage(a0size,asize,ncomponents,antialias);
   for(size_t i=0; i < asize; i++) {
     array *ai=read<array *>(a,i);
     size_t size=ai->size();
@@ -628,7 +843,7 @@ void psfile::image(const array& a, bool antialias)
       write(p,ncomponents);
     }
   }
-  endImage(antialias,a0size,asize,ncomponents);
+  endImage();
 }
   
 void psfile::image(stack *Stack, callable *f, Int width, Int height,
@@ -650,33 +865,28 @@ void psfile::image(stack *Stack, callable *f, Int width, Int height,
   
   imageheader(width,height,colorspace);
     
-  beginImage(ncomponents*width*height);
+  // The interpreter is not reentrant, so f is called once per pixel; each
+  // row of pens is then converted to color bytes and written as a block.
+  mem::vector<pen> pens(width);
+  std::vector<unsigned char> row(ncomponents*width);
+  beginImage(width,height,ncomponents,antialias);
   for(Int j=0; j < height; j++) {
     for(Int i=0; i < width; i++) {
       Stack->push(j);
       Stack->push(i);
       f->call(Stack);
-      pen p=pop<pen>(Stack);
+      pens[i]=pop<pen>(Stack);
+    }
+    for(Int i=0; i < width; i++) {
+      pen& p=pens[i];
       p.convert();
-      if(!p.promote(colorspace))
+      if(p.colorspace() != colorspace && !p.promote(colorspace))
         reportError(inconsistent);
-      write(&p,ncomponents);
+      penbytes(&p,&row[ncomponents*i],ncomponents);
     }
+    writeBytes(&row[0],row.size());
   }
-  endImage(antialias,width,height,ncomponents);
-}
-  
-void psfile::outImage(bool antialias, size_t width, size_t height,
-                      size_t ncomponents)
-{
-  if(antialias) dealias(buffer,width,height,ncomponents);
-  if(settings::getSetting<Int>("level") >= 3)
-    writeCompressed(buffer,count);
-  else {
-    encode85 e(out);
-    for(size_t i=0; i < count; ++i)
-      e.put(buffer[i]);
-  }
+  endImage();
 }
   
 void psfile::rawimage(unsigned char *a, size_t width, size_t height,
@@ -691,12 +901,11 @@ void psfile::rawimage(unsigned char *a, size_t width, size_t height,
   
   imageheader(width,height,colorspace);
   
-  count=ncomponents*width*height;
   if(colorspace == RGB) {
-    buffer=a;
-    outImage(antialias,width,height,ncomponents);
+    beginImage(width,height,ncomponents,antialias);
+    writeBytes(a,ncomponents*width*height);
   } else {
-    beginImage(count);
+    beginImage(width,height,ncomponents);
     if(antialias)
       dealias(a,width,height,ncomponents,true,colorspace);
     else {
@@ -709,8 +918,8 @@ void psfile::rawimage(unsigned char *a, size_t width, size_t height,
         }
       }
     }
-    endImage(false,width,height,ncomponents);
   }
+  endImage();
 }
 
 } //namespace camp
@@ -12,6 +12,8 @@
 #include <fstream>
 #include <iomanip>
 #include <sstream>
+#include <vector>
+#include <zlib.h>
 
 #include "pair.h"
 #include "path.h"
@@ -19,6 +21,7 @@
 #include "pen.h"
 #include "array.h"
 #include "callable.h"
+#include "numformat.h"
 
 namespace camp {
 
@@ -30,8 +33,17 @@ inline void BoundingBox(std::ostream& s, const bbox& box)
   s << "%%HiResBoundingBox: " << std::setprecision(9) << box << newl;
 }
 
+// A filter through which a stream of data is written.
+class encoder {
+public:
+  virtual ~encoder() {}
+  virtual void put(const unsigned char *a, size_t n)=0;
+  // Flush any buffered data once all of it has been put.
+  virtual void close() {}
+};
+
 // An ASCII85Encode filter.
-class encode85 {
+class encode85 : public encoder {
   ostream *out;
   int tuple;
   int pos;
@@ -92,47 +104,106 @@ public:
         break;
     }
   }
+  
+  void put(const unsigned char *a, size_t n) {
+    for(size_t i=0; i < n; ++i)
+      put(a[i]);
+  }
+};
+
+// A FlateEncode filter that compresses its input as it arrives, passing the
+// result on to the filter next or, if next is NULL, writing it to out. The
+// compressed stream is complete only once close has been called.
+class encodeFlate : public encoder {
+  ostream *out;
+  encoder *next;
+  bool closed;
+  z_stream z;
+  static const size_t chunk=16384;
+  Bytef output[chunk];
+  
+  void deflate(int flush);
+public:
+  encodeFlate(ostream *out, encoder *next=NULL);
+  ~encodeFlate();
+  
+  void put(const unsigned char *a, size_t n);
+  void close();
+};
+
+// A filter that appends its input to a buffer.
+class collect : public encoder {
+  std::vector<unsigned char>& data;
+public:
+  collect(std::vector<unsigned char>& data) : data(data) {}
+
+  void put(const unsigned char *a, size_t n) {
+    data.insert(data.end(),a,a+n);
+  }
 };
 
 class psfile {
 protected:  
   mem::stack<pen> pens;
   
+  // The simplification tolerance and linear transformation saved by each
+  // gsave, and the tolerance saved at each picture boundary.
+  mem::stack<std::pair<double,transform> > simplifystates;
+  mem::stack<double> tolerances;
+  
 public:
   
   string filename;
   bool pdfformat;    // Is final output format PDF?
   bool pdf;          // Output direct PDF?
   bool transparency; // Is transparency used?
+  double tolerance;  // Tolerance for simplifying straight path segments
+  double resolution; // Device units per PostScript point
+  transform linear;  // Linear part of the map to device units
+  
+  // Image data is buffered in blocks of complete rows, which are
+  // dealiased if requested and then passed through the image encoder.
   unsigned char *buffer;
-  size_t count;
+  size_t count;       // number of bytes in buffer
+  size_t buffersize;
+  size_t rowsize;     // number of bytes per row
+  size_t rows;        // number of image rows not yet encoded
+  size_t pixelsize;   // number of bytes per pixel
+  bool antialias;
+  encoder *imageencoder;
 
-  void write(pen *p, size_t ncomponents);
+  static void penbytes(pen *p, unsigned char *b, size_t ncomponents);
+  
+  void write(pen *p, size_t ncomponents) {
+    penbytes(p,buffer+count,ncomponents);
+    count += ncomponents;
+    if(count == buffersize) flushImage();
+  }
+  
   void writefromRGB(unsigned char r, unsigned char g, unsigned char b, 
                     ColorSpace colorspace, size_t ncomponents);
   
-  void writeCompressed(const unsigned char *a, size_t size);
   void dealias(unsigned char *a, size_t width, size_t height, size_t n,
                bool convertrgb=false, ColorSpace colorspace=DEFCOLOR);
   
-  void beginImage(size_t n) {
-    buffer=new unsigned char[n];
-    count=0;
-  }
+  void beginImage(size_t width, size_t height, size_t ncomponents,
+                  bool antialias=false);
+  void flushImage();
+  void endImage();
   
-  void outImage(bool antialias, size_t width, size_t height,
-                size_t ncomponents);
+  // Return a new filter for the data of the current image.
+  virtual encoder *newencoder();
   
-  void endImage(bool antialias, size_t width, size_t height,
-                size_t ncomponents) {
-    outImage(antialias,width,height,ncomponents);
-    delete[] buffer;
-  }
+  // Complete the current image once all of its data has been encoded.
+  virtual void outImage() {}
   
   void writeByte(unsigned char n) {
     buffer[count++]=n;
+    if(count == buffersize) flushImage();
   }
   
+  void writeBytes(const unsigned char *a, size_t n);
+  
 protected:
   pen lastpen;
   std::ostream *out;
@@ -140,7 +211,10 @@ protected:
 public: 
   psfile(const string& filename, bool pdfformat);
   
-  psfile() {pdf=settings::pdf(settings::getSetting<string>("tex"));}
+  psfile() : tolerance(settings::getSetting<double>("simplify")),
+             resolution(1.0) {
+    pdf=settings::pdf(settings::getSetting<string>("tex"));
+  }
 
   virtual ~psfile();
   
@@ -155,7 +229,8 @@ public:
   void close();
   
   void write(double x) {
-    *out << " " << x;
+    *out << " ";
+    writenumber(*out,x);
   }
 
   void writenewl() {
@@ -167,14 +242,18 @@ public:
   }
   
   void write(pair z) {
-    *out << " " << z.getx() << " " << z.gety();
+    write(z.getx());
+    write(z.gety());
   }
 
   void write(transform t) {
     if(!pdf) *out << "[";
-    *out << " " << t.getxx() << " " << t.getyx()
-         << " " << t.getxy() << " " << t.getyy()
-         << " " << t.getx() << " " << t.gety();
+    write(t.getxx());
+    write(t.getyx());
+    write(t.getxy());
+    write(t.getyy());
+    write(t.getx());
+    write(t.gety());
     if(!pdf) *out << "]";
   }
 
@@ -184,7 +263,7 @@ public:
   }
   
   void setcolor(const pen& p, const string& begin, const string& end);
-  void setopacity(const pen& p);
+  virtual void setopacity(const pen& p);
 
   virtual void setpen(pen p);
   
@@ -295,7 +374,8 @@ public:
   
   void vertexpen(vm::array *pi, int j, ColorSpace colorspace);
   
-  void imageheader(size_t width, size_t height, ColorSpace colorspace);
+  virtual void imageheader(size_t width, size_t height,
+                           ColorSpace colorspace);
   
   void image(const vm::array& a, const vm::array& p, bool antialias);
   void image(const vm::array& a, bool antialias);
@@ -309,6 +389,7 @@ public:
     else *out << "gsave";
     if(!tex) *out << newl;
     pens.push(lastpen);
+    simplifystates.push(std::make_pair(tolerance,linear));
   }
   
   virtual void grestore(bool tex=false) {
@@ -316,6 +397,9 @@ public:
       reportError("grestore without matching gsave");
     lastpen=pens.top();
     pens.pop();
+    tolerance=simplifystates.top().first;
+    linear=simplifystates.top().second;
+    simplifystates.pop();
     if(pdf) *out << "Q";
     else *out << "grestore";
     if(!tex) *out << newl;
@@ -332,16 +416,29 @@ public:
   // Multiply on a transform to the transformation matrix.
   virtual void concat(transform t) {
     if(t.isIdentity()) return;
+    linear=linear*shiftless(t);
     write(t);
     if(pdf) *out << " cm" << newl;
     else *out << " concat" << newl;
   }
   
-  void verbatimline(const string& s) {
+  // Save and restore the simplification tolerance across a picture
+  // boundary.
+  void savetolerance() {
+    tolerances.push(tolerance);
+  }
+  
+  void restoretolerance() {
+    if(tolerances.empty()) return;
+    tolerance=tolerances.top();
+    tolerances.pop();
+  }
+  
+  virtual void verbatimline(const string& s) {
     *out << s << newl;
   }
   
-  void verbatim(const string& s) {
+  virtual void verbatim(const string& s) {
     *out << s;
   }
 
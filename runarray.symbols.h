@@ -0,0 +1,62 @@
+/*****
+ * This file is automatically generated by findsym.pl
+ * Changes will be overwritten.
+ *****/
+
+// If the ADDSYMBOL macro is not already defined, define it with the default
+// purpose of referring to an external pre-translated symbol, such that
+// SYM(name) also refers to that symbol.
+#ifndef ADDSYMBOL
+    #define ADDSYMBOL(name) extern sym::symbol PRETRANSLATED_SYMBOL_##name
+    #define SYM(name) PRETRANSLATED_SYMBOL_##name
+#endif
+
+ADDSYMBOL(AtA);
+ADDSYMBOL(_findroot);
+ADDSYMBOL(_projection);
+ADDSYMBOL(a);
+ADDSYMBOL(acc);
+ADDSYMBOL(all);
+ADDSYMBOL(b);
+ADDSYMBOL(c);
+ADDSYMBOL(change2);
+ADDSYMBOL(complement);
+ADDSYMBOL(crfft);
+ADDSYMBOL(determinant);
+ADDSYMBOL(dot);
+ADDSYMBOL(dxmax);
+ADDSYMBOL(f);
+ADDSYMBOL(fa);
+ADDSYMBOL(fb);
+ADDSYMBOL(fft);
+ADDSYMBOL(find);
+ADDSYMBOL(fprime);
+ADDSYMBOL(identity);
+ADDSYMBOL(inverse);
+ADDSYMBOL(iterations);
+ADDSYMBOL(maxbezier);
+ADDSYMBOL(maxratio);
+ADDSYMBOL(minbezier);
+ADDSYMBOL(minratio);
+ADDSYMBOL(n);
+ADDSYMBOL(newton);
+ADDSYMBOL(norm);
+ADDSYMBOL(p);
+ADDSYMBOL(project);
+ADDSYMBOL(rcfft);
+ADDSYMBOL(sequence);
+ADDSYMBOL(sign);
+ADDSYMBOL(simpson);
+ADDSYMBOL(solve);
+ADDSYMBOL(sum);
+ADDSYMBOL(t);
+ADDSYMBOL(tolerance);
+ADDSYMBOL(triangulate);
+ADDSYMBOL(tridiagonal);
+ADDSYMBOL(v);
+ADDSYMBOL(verbose);
+ADDSYMBOL(warn);
+ADDSYMBOL(x);
+ADDSYMBOL(x1);
+ADDSYMBOL(x2);
+ADDSYMBOL(z);
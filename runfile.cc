@@ -0,0 +1,1059 @@
+/***** Autogenerated from runfile.in; changes will be overwritten *****/
+
+#line 1 "runtimebase.in"
+/*****
+ * runtimebase.in
+ * Andy Hammerlindl  2009/07/28
+ *
+ * Common declarations needed for all code-generating .in files.
+ *
+ *****/
+
+
+#line 1 "runfile.in"
+/*****
+ * runfile.in
+ *
+ * Runtime functions for file operations.
+ *
+ *****/
+
+#line 1 "runtimebase.in"
+#include "stack.h"
+#include "types.h"
+#include "builtin.h"
+#include "entry.h"
+#include "errormsg.h"
+#include "array.h"
+#include "triple.h"
+#include "callable.h"
+#include "opsymbols.h"
+
+using vm::stack;
+using vm::error;
+using vm::array;
+using vm::read;
+using vm::callable;
+using types::formal;
+using types::function;
+using camp::triple;
+
+#define PRIMITIVE(name,Name,asyName) using types::prim##Name;
+#include <primitives.h>
+#undef PRIMITIVE
+
+typedef double real;
+
+void unused(void *);
+
+namespace run {
+array *copyArray(array *a);
+array *copyArray2(array *a);
+array *copyArray3(array *a);
+
+double *copyTripleArray2Components(array *a, size_t &N,
+                                   GCPlacement placement=NoGC);
+triple *copyTripleArray2C(array *a, size_t &N,
+                          GCPlacement placement=NoGC);
+}
+
+function *realRealFunction();
+
+#define CURRENTPEN processData().currentpen
+
+#line 16 "runfile.in"
+#include "fileio.h"
+#include "arrowfile.h"
+#include "callable.h"
+#include "triple.h"
+#include "array.h"
+#include "arrayop.h"
+#include "picture.h"
+
+#ifdef __CYGWIN__
+extern "C" int mkstemp(char *c);
+#endif
+
+using namespace camp;
+using namespace settings;
+using namespace vm;
+
+typedef array Intarray;
+typedef array Intarray2;
+typedef array realarray;
+typedef array realarray2;
+typedef array stringarray;
+
+using types::IntArray;
+using types::IntArray2;
+using types::realArray;
+using types::realArray2;
+using types::stringArray;
+
+string commentchar="#";
+
+// Reads the remaining reals of a file one row at a time, where a row is a
+// line of a text file or a single value of a binary file.
+class rowreader {
+  file *f;
+  bool linemode;
+  bool rows;
+  bool keep;
+public:
+  // If keep is true, the file stays mapped into memory so that a later
+  // reader continues from the same mapping.
+  rowreader(file *f, bool keep=false) : f(f), linemode(f->LineMode()),
+                                        rows(!f->Binary()), keep(keep) {
+    f->LineMode(rows);
+    f->map();
+  }
+  
+  ~rowreader() {
+    if(!keep || f->eof()) f->unmap();
+    f->LineMode(linemode);
+  }
+  
+  // Read the next value, returning false at the end of the file.
+  bool next(double& v) {
+    f->read(v);
+    return !f->error();
+  }
+  
+  // Was the last value read at the end of its row?
+  bool eol() {return !rows || f->nexteol();}
+};
+
+typedef void reduction(double& x, double v);
+
+void minimum(double& x, double v) {if(v < x) x=v;}
+void maximum(double& x, double v) {if(v > x) x=v;}
+void total(double& x, double v) {x += v;}
+
+// Reduce each column of the remaining rows of f without storing the rows.
+array *reduce(file *f, reduction *op)
+{
+  std::vector<double> x;
+  if(f->isOpen()) {
+    rowreader r(f);
+    size_t j=0;
+    double v;
+    while(r.next(v)) {
+      if(j < x.size()) op(x[j],v);
+      else x.push_back(v);
+      j=r.eol() ? 0 : j+1;
+    }
+  }
+  size_t n=x.size();
+  array *a=new array(n);
+  for(size_t j=0; j < n; ++j)
+    (*a)[j]=x[j];
+  return a;
+}
+
+// Return the bin of [0,n) containing the real t, or -1 if there is none.
+inline Int bin(double t, Int n)
+{
+  return t >= 0 && t < n ? (Int) t : -1;
+}
+
+// Return f as an Arrow file.
+iarrowfile *arrowfile(file *f)
+{
+  iarrowfile *a=dynamic_cast<iarrowfile *>(f);
+  if(!a) {
+    ostringstream buf;
+    buf << f->filename() << ": not an Arrow file";
+    error(buf);
+  }
+  return a;
+}
+
+// Autogenerated routines:
+
+
+
+#ifndef NOSYM
+#include "runfile.symbols.h"
+
+#endif
+namespace run {
+#line 125 "runfile.in"
+// bool ==(file *a, file *b);
+void gen_runfile0(stack *Stack)
+{
+  file * b=vm::pop<file *>(Stack);
+  file * a=vm::pop<file *>(Stack);
+#line 126 "runfile.in"
+  {Stack->push<bool>(a == b); return;}
+}
+
+#line 130 "runfile.in"
+// bool !=(file *a, file *b);
+void gen_runfile1(stack *Stack)
+{
+  file * b=vm::pop<file *>(Stack);
+  file * a=vm::pop<file *>(Stack);
+#line 131 "runfile.in"
+  {Stack->push<bool>(a != b); return;}
+}
+
+#line 135 "runfile.in"
+void nullFile(stack *Stack)
+{
+#line 136 "runfile.in"
+  {Stack->push<file*>(&camp::nullfile); return;}
+}
+
+#line 140 "runfile.in"
+// file* input(string name=emptystring, bool check=true,            string comment=commentchar, string mode=emptystring);
+void gen_runfile3(stack *Stack)
+{
+  string mode=vm::pop<string>(Stack,emptystring);
+  string comment=vm::pop<string>(Stack,commentchar);
+  bool check=vm::pop<bool>(Stack,true);
+  string name=vm::pop<string>(Stack,emptystring);
+#line 142 "runfile.in"
+  file *f=NULL;
+  if(mode == "binary") {
+    f=new ibfile(name,check);
+  } else if(mode == "xdr") {
+#ifdef HAVE_RPC_RPC_H
+    f=new ixfile(name,check);    
+#else  
+  ostringstream buf;
+  buf << name << ": XDR read support not enabled";
+  error(buf);
+#endif
+  } else if(mode == "arrow") {
+    f=new iarrowfile(name,check);
+  } else if(mode == "") {
+    char c=comment.empty() ? (char) 0 : comment[0];
+    f=new ifile(name,c,check);
+  } else {
+    f=NULL;
+    ostringstream buf;
+    buf << name << ": invalid file mode '" << mode << "'";
+    error(buf);
+  }
+  
+  f->open();
+  {Stack->push<file*>(f); return;}
+}
+
+#line 170 "runfile.in"
+// file* output(string name=emptystring, bool update=false,             string comment=commentchar, string mode=emptystring);
+void gen_runfile4(stack *Stack)
+{
+  string mode=vm::pop<string>(Stack,emptystring);
+  string comment=vm::pop<string>(Stack,commentchar);
+  bool update=vm::pop<bool>(Stack,false);
+  string name=vm::pop<string>(Stack,emptystring);
+#line 172 "runfile.in"
+  file *f=NULL;
+  if(mode == "pipe") {
+    f=new opipe(name);
+  } else if(mode == "binary") {
+    if(update) f=new iobfile(name);
+    else f=new obfile(name);
+  } else if(mode == "xdr") {
+#ifdef HAVE_RPC_RPC_H
+    if(update)
+      f=new ioxfile(name);
+    else f=new oxfile(name);
+#else  
+    ostringstream buf;
+    buf << name << ": XDR write support not enabled";
+    error(buf);
+#endif
+  } else if(mode == "") {
+    if(update) {
+      char c=comment.empty() ? (char) 0 : comment[0];
+      f=new iofile(name,c);
+    } else f=new ofile(name);
+  } else {
+    f=NULL;
+    ostringstream buf;
+    buf << name << ": invalid file mode '" << mode << "'";
+    error(buf);
+  }
+  
+  f->open();
+  if(update) f->seek(0,false);
+  
+  {Stack->push<file*>(f); return;}
+}
+
+#line 207 "runfile.in"
+// bool eof(file *f);
+void gen_runfile5(stack *Stack)
+{
+  file * f=vm::pop<file *>(Stack);
+#line 208 "runfile.in"
+  {Stack->push<bool>(f->eof()); return;}
+}
+
+#line 212 "runfile.in"
+// bool eol(file *f);
+void gen_runfile6(stack *Stack)
+{
+  file * f=vm::pop<file *>(Stack);
+#line 213 "runfile.in"
+  {Stack->push<bool>(f->eol()); return;}
+}
+
+#line 217 "runfile.in"
+// bool error(file *f);
+void gen_runfile7(stack *Stack)
+{
+  file * f=vm::pop<file *>(Stack);
+#line 218 "runfile.in"
+  {Stack->push<bool>(f->error()); return;}
+}
+
+#line 222 "runfile.in"
+// void clear(file *f);
+void gen_runfile8(stack *Stack)
+{
+  file * f=vm::pop<file *>(Stack);
+#line 223 "runfile.in"
+  f->clear();
+}
+
+#line 227 "runfile.in"
+// void close(file *f);
+void gen_runfile9(stack *Stack)
+{
+  file * f=vm::pop<file *>(Stack);
+#line 228 "runfile.in"
+  f->close();
+}
+
+#line 232 "runfile.in"
+// Int precision(file *f=NULL, Int digits=0);
+void gen_runfile10(stack *Stack)
+{
+  Int digits=vm::pop<Int>(Stack,0);
+  file * f=vm::pop<file *>(Stack,NULL);
+#line 233 "runfile.in"
+  if(f == 0) f=&camp::Stdout;
+  {Stack->push<Int>(f->precision(digits)); return;}
+}
+
+#line 238 "runfile.in"
+// void flush(file *f);
+void gen_runfile11(stack *Stack)
+{
+  file * f=vm::pop<file *>(Stack);
+#line 239 "runfile.in"
+  f->flush();
+}
+
+#line 243 "runfile.in"
+// string getc(file *f);
+void gen_runfile12(stack *Stack)
+{
+  file * f=vm::pop<file *>(Stack);
+#line 244 "runfile.in"
+  char c=0;
+  if(f->isOpen()) f->read(c);
+  static char str[1];
+  str[0]=c;
+  {Stack->push<string>(string(str)); return;}
+}
+
+#line 252 "runfile.in"
+// Int tell(file *f);
+void gen_runfile13(stack *Stack)
+{
+  file * f=vm::pop<file *>(Stack);
+#line 253 "runfile.in"
+  {Stack->push<Int>(f->tell()); return;}
+}
+
+#line 257 "runfile.in"
+// void seek(file *f, Int pos);
+void gen_runfile14(stack *Stack)
+{
+  Int pos=vm::pop<Int>(Stack);
+  file * f=vm::pop<file *>(Stack);
+#line 258 "runfile.in"
+  f->seek(pos,pos >= 0);
+}
+
+#line 262 "runfile.in"
+// void seekeof(file *f);
+void gen_runfile15(stack *Stack)
+{
+  file * f=vm::pop<file *>(Stack);
+#line 263 "runfile.in"
+  f->seek(0,false);
+}
+
+#line 267 "runfile.in"
+void namePart(stack *Stack)
+{
+  file f=vm::pop<file>(Stack);
+#line 268 "runfile.in"
+  {Stack->push<string>(f.filename()); return;}
+}
+
+#line 272 "runfile.in"
+void modePart(stack *Stack)
+{
+  file f=vm::pop<file>(Stack);
+#line 273 "runfile.in"
+  {Stack->push<string>(f.FileMode()); return;}
+}
+
+// Set file dimensions
+#line 278 "runfile.in"
+void dimensionSetHelper(stack *Stack)
+{
+  file * f=vm::pop<file *>(Stack);
+  Int nz=vm::pop<Int>(Stack,-1);
+  Int ny=vm::pop<Int>(Stack,-1);
+  Int nx=vm::pop<Int>(Stack,-1);
+#line 279 "runfile.in"
+  f->dimension(nx,ny,nz);
+  {Stack->push<file*>(f); return;}
+}
+
+#line 284 "runfile.in"
+void dimensionSet(stack *Stack)
+{
+  file * f=vm::pop<file *>(Stack);
+#line 285 "runfile.in"
+  {Stack->push<callable*>(new thunk(new bfunc(dimensionSetHelper),f)); return;}
+}
+
+#line 289 "runfile.in"
+void dimensionPart(stack *Stack)
+{
+  file f=vm::pop<file>(Stack);
+#line 290 "runfile.in"
+  array *a=new array(3);
+  (*a)[0]=f.Nx();
+  (*a)[1]=f.Ny();
+  (*a)[2]=f.Nz();
+  {Stack->push<array*>(a); return;}
+}
+
+// Set file f to read arrays in line-at-a-time mode
+#line 299 "runfile.in"
+void lineSetHelper(stack *Stack)
+{
+  file * f=vm::pop<file *>(Stack);
+  bool b=vm::pop<bool>(Stack,true);
+#line 300 "runfile.in"
+  f->LineMode(b);
+  {Stack->push<file*>(f); return;}
+}
+
+#line 305 "runfile.in"
+void lineSet(stack *Stack)
+{
+  file * f=vm::pop<file *>(Stack);
+#line 306 "runfile.in"
+  {Stack->push<callable*>(new thunk(new bfunc(lineSetHelper),f)); return;}
+}
+
+#line 310 "runfile.in"
+void linePart(stack *Stack)
+{
+  file f=vm::pop<file>(Stack);
+#line 311 "runfile.in"
+  {Stack->push<bool>(f.LineMode()); return;}
+}
+
+// Set file to read comma-separated values
+#line 316 "runfile.in"
+void csvSetHelper(stack *Stack)
+{
+  file * f=vm::pop<file *>(Stack);
+  bool b=vm::pop<bool>(Stack,true);
+#line 317 "runfile.in"
+  f->CSVMode(b);
+  {Stack->push<file*>(f); return;}
+}
+
+#line 322 "runfile.in"
+void csvSet(stack *Stack)
+{
+  file * f=vm::pop<file *>(Stack);
+#line 323 "runfile.in"
+  {Stack->push<callable*>(new thunk(new bfunc(csvSetHelper),f)); return;}
+}
+
+#line 327 "runfile.in"
+void csvPart(stack *Stack)
+{
+  file f=vm::pop<file>(Stack);
+#line 328 "runfile.in"
+  {Stack->push<bool>(f.CSVMode()); return;}
+}
+
+// Set file to read whitespace-separated values
+#line 333 "runfile.in"
+void wordSetHelper(stack *Stack)
+{
+  file * f=vm::pop<file *>(Stack);
+  bool b=vm::pop<bool>(Stack,true);
+#line 334 "runfile.in"
+  f->WordMode(b);
+  {Stack->push<file*>(f); return;}
+}
+
+#line 339 "runfile.in"
+void wordSet(stack *Stack)
+{
+  file * f=vm::pop<file *>(Stack);
+#line 340 "runfile.in"
+  {Stack->push<callable*>(new thunk(new bfunc(wordSetHelper),f)); return;}
+}
+
+#line 344 "runfile.in"
+void wordPart(stack *Stack)
+{
+  file f=vm::pop<file>(Stack);
+#line 345 "runfile.in"
+  {Stack->push<bool>(f.WordMode()); return;}
+}
+
+// Set file to read/write single precision real XDR values.
+#line 350 "runfile.in"
+void singlerealSetHelper(stack *Stack)
+{
+  file * f=vm::pop<file *>(Stack);
+  bool b=vm::pop<bool>(Stack,true);
+#line 351 "runfile.in"
+  f->SingleReal(b);
+  {Stack->push<file*>(f); return;}
+}
+
+#line 356 "runfile.in"
+void singlerealSet(stack *Stack)
+{
+  file * f=vm::pop<file *>(Stack);
+#line 357 "runfile.in"
+  {Stack->push<callable*>(new thunk(new bfunc(singlerealSetHelper),f)); return;}
+}
+
+#line 361 "runfile.in"
+void singlerealPart(stack *Stack)
+{
+  file f=vm::pop<file>(Stack);
+#line 362 "runfile.in"
+  {Stack->push<bool>(f.SingleReal()); return;}
+}
+
+// Set file to read/write single precision int XDR values.
+#line 367 "runfile.in"
+void singleintSetHelper(stack *Stack)
+{
+  file * f=vm::pop<file *>(Stack);
+  bool b=vm::pop<bool>(Stack,true);
+#line 368 "runfile.in"
+  f->SingleInt(b);
+  {Stack->push<file*>(f); return;}
+}
+
+#line 373 "runfile.in"
+void singleintSet(stack *Stack)
+{
+  file * f=vm::pop<file *>(Stack);
+#line 374 "runfile.in"
+  {Stack->push<callable*>(new thunk(new bfunc(singleintSetHelper),f)); return;}
+}
+
+#line 378 "runfile.in"
+void singleintPart(stack *Stack)
+{
+  file f=vm::pop<file>(Stack);
+#line 379 "runfile.in"
+  {Stack->push<bool>(f.SingleInt()); return;}
+}
+
+// Set file to read/write signed int XDR values.
+#line 384 "runfile.in"
+void signedintSetHelper(stack *Stack)
+{
+  file * f=vm::pop<file *>(Stack);
+  bool b=vm::pop<bool>(Stack,true);
+#line 385 "runfile.in"
+  f->SignedInt(b);
+  {Stack->push<file*>(f); return;}
+}
+
+#line 390 "runfile.in"
+void signedintSet(stack *Stack)
+{
+  file * f=vm::pop<file *>(Stack);
+#line 391 "runfile.in"
+  {Stack->push<callable*>(new thunk(new bfunc(signedintSetHelper),f)); return;}
+}
+
+#line 395 "runfile.in"
+void signedintPart(stack *Stack)
+{
+  file f=vm::pop<file>(Stack);
+#line 396 "runfile.in"
+  {Stack->push<bool>(f.SignedInt()); return;}
+}
+
+// Set file to read ahead in a background thread
+#line 401 "runfile.in"
+void prefetchSetHelper(stack *Stack)
+{
+  file * f=vm::pop<file *>(Stack);
+  bool b=vm::pop<bool>(Stack,true);
+#line 402 "runfile.in"
+  f->Prefetch(b);
+  {Stack->push<file*>(f); return;}
+}
+
+#line 407 "runfile.in"
+void prefetchSet(stack *Stack)
+{
+  file * f=vm::pop<file *>(Stack);
+#line 408 "runfile.in"
+  {Stack->push<callable*>(new thunk(new bfunc(prefetchSetHelper),f)); return;}
+}
+
+#line 412 "runfile.in"
+void prefetchPart(stack *Stack)
+{
+  file * f=vm::pop<file *>(Stack);
+#line 413 "runfile.in"
+  {Stack->push<bool>(f->Prefetch()); return;}
+}
+
+// Set file to read an arrayi (i int sizes followed by an i-dimensional array)
+#line 418 "runfile.in"
+void readSetHelper(stack *Stack)
+{
+  file * f=vm::pop<file *>(Stack);
+  Int i=vm::pop<Int>(Stack);
+#line 419 "runfile.in"
+  switch(i) {
+    case 1:
+      f->dimension(-2);
+      break;
+      
+    case 2:
+      f->dimension(-2,-2);
+      break;
+      
+    case 3:
+      f->dimension(-2,-2,-2);
+      break;
+      
+    default:
+      f->dimension();
+  }
+  
+  {Stack->push<file*>(f); return;}
+}
+
+#line 440 "runfile.in"
+void readSet(stack *Stack)
+{
+  file * f=vm::pop<file *>(Stack);
+#line 441 "runfile.in"
+  {Stack->push<callable*>(new thunk(new bfunc(readSetHelper),f)); return;}
+}
+
+// Read up to n further rows of reals from f, where a row is a line of a
+// text file or a single value of a binary file. Fewer than n rows are
+// returned only at the end of the file.
+#line 448 "runfile.in"
+// realarray2* readrows(file *f, Int n);
+void gen_runfile44(stack *Stack)
+{
+  Int n=vm::pop<Int>(Stack);
+  file * f=vm::pop<file *>(Stack);
+#line 449 "runfile.in"
+  array *a=new array(0);
+  if(n > 0 && f->isOpen()) {
+    rowreader r(f,true);
+    array *row=NULL;
+    double v;
+    while(r.next(v)) {
+      if(!row) row=new array(0);
+      row->push(v);
+      if(r.eol()) {
+        a->push(row);
+        row=NULL;
+        if((Int) a->size() == n) break;
+      }
+    }
+    if(row) a->push(row);
+  }
+  {Stack->push<realarray2*>(a); return;}
+}
+
+// Write the rows of a to f, separating the values in each row of a text
+// file with separator. If async is true, a background thread writes the
+// output of a text file while it is being formatted.
+#line 472 "runfile.in"
+// void writerows(file *f, realarray2 *a, string separator=tab,               bool async=false);
+void gen_runfile45(stack *Stack)
+{
+  bool async=vm::pop<bool>(Stack,false);
+  string separator=vm::pop<string>(Stack,tab);
+  realarray2 * a=vm::pop<realarray2 *>(Stack);
+  file * f=vm::pop<file *>(Stack);
+#line 474 "runfile.in"
+  writeRows<double>(f,a,separator,async);
+}
+
+#line 478 "runfile.in"
+// void writerows(file *f, Intarray2 *a, string separator=tab,               bool async=false);
+void gen_runfile46(stack *Stack)
+{
+  bool async=vm::pop<bool>(Stack,false);
+  string separator=vm::pop<string>(Stack,tab);
+  Intarray2 * a=vm::pop<Intarray2 *>(Stack);
+  file * f=vm::pop<file *>(Stack);
+#line 480 "runfile.in"
+  writeRows<Int>(f,a,separator,async);
+}
+
+// Return the minimum of each column of the remaining rows of f.
+#line 485 "runfile.in"
+// realarray* min(file *f);
+void gen_runfile47(stack *Stack)
+{
+  file * f=vm::pop<file *>(Stack);
+#line 486 "runfile.in"
+  {Stack->push<realarray*>(reduce(f,minimum)); return;}
+}
+
+// Return the maximum of each column of the remaining rows of f.
+#line 491 "runfile.in"
+// realarray* max(file *f);
+void gen_runfile48(stack *Stack)
+{
+  file * f=vm::pop<file *>(Stack);
+#line 492 "runfile.in"
+  {Stack->push<realarray*>(reduce(f,maximum)); return;}
+}
+
+// Return the sum of each column of the remaining rows of f.
+#line 497 "runfile.in"
+// realarray* sum(file *f);
+void gen_runfile49(stack *Stack)
+{
+  file * f=vm::pop<file *>(Stack);
+#line 498 "runfile.in"
+  {Stack->push<realarray*>(reduce(f,total)); return;}
+}
+
+// Return frequency count of the remaining reals of f in n uniform bins
+// from a to b.
+#line 504 "runfile.in"
+// Intarray* frequency(file *f, real a, real b, Int n);
+void gen_runfile50(stack *Stack)
+{
+  Int n=vm::pop<Int>(Stack);
+  real b=vm::pop<real>(Stack);
+  real a=vm::pop<real>(Stack);
+  file * f=vm::pop<file *>(Stack);
+#line 505 "runfile.in"
+  if(n < 0) error("negative number of bins");
+  std::vector<Int> count(n);
+  if(f->isOpen()) {
+    rowreader r(f);
+    double h=n/(b-a);
+    double v;
+    while(r.next(v)) {
+      Int i=bin((v-a)*h,n);
+      if(i >= 0) ++count[i];
+      r.eol();
+    }
+  }
+  array *freq=new array(n);
+  for(Int i=0; i < n; ++i)
+    (*freq)[i]=count[i];
+  {Stack->push<Intarray*>(freq); return;}
+}
+
+// Return frequency count of the remaining pairs of reals x y of f in
+// nx by ny uniform bins in box(a,b), where ny defaults to nx. The corners
+// are explicit so that calls with real bounds are not ambiguous.
+#line 527 "runfile.in"
+// Intarray2* frequency(file *f, explicit pair a, explicit pair b, Int nx,                     Int ny=-1);
+void gen_runfile51(stack *Stack)
+{
+  Int ny=vm::pop<Int>(Stack,-1);
+  Int nx=vm::pop<Int>(Stack);
+  pair b=vm::pop<pair>(Stack);
+  pair a=vm::pop<pair>(Stack);
+  file * f=vm::pop<file *>(Stack);
+#line 529 "runfile.in"
+  if(ny == -1) ny=nx;
+  if(nx < 0 || ny < 0) error("negative number of bins");
+  std::vector<Int> count(nx*ny);
+  if(f->isOpen()) {
+    rowreader r(f);
+    double hx=nx/(b.getx()-a.getx());
+    double hy=ny/(b.gety()-a.gety());
+    double x,y;
+    while(r.next(x)) {
+      r.eol();
+      if(!r.next(y)) break;
+      r.eol();
+      Int i=bin((x-a.getx())*hx,nx);
+      Int j=bin((y-a.gety())*hy,ny);
+      if(i >= 0 && j >= 0) ++count[i*ny+j];
+    }
+  }
+  array *freq=new array(nx);
+  for(Int i=0; i < nx; ++i) {
+    array *freqi=new array(ny);
+    for(Int j=0; j < ny; ++j)
+      (*freqi)[j]=count[i*ny+j];
+    (*freq)[i]=freqi;
+  }
+  {Stack->push<Intarray2*>(freq); return;}
+}
+
+// Return the column names of an Arrow file.
+#line 558 "runfile.in"
+// stringarray* columns(file *f);
+void gen_runfile52(stack *Stack)
+{
+  file * f=vm::pop<file *>(Stack);
+#line 559 "runfile.in"
+  {Stack->push<stringarray*>(arrowfile(f)->names()); return;}
+}
+
+// Return the number of rows of an Arrow file.
+#line 564 "runfile.in"
+// Int length(file *f);
+void gen_runfile53(stack *Stack)
+{
+  file * f=vm::pop<file *>(Stack);
+#line 565 "runfile.in"
+  {Stack->push<Int>(arrowfile(f)->length()); return;}
+}
+
+// Return n rows of the named column of an Arrow file as reals, starting
+// at row start; n < 0 reads to the end. Null entries are read as nan.
+#line 571 "runfile.in"
+// realarray* realcolumn(file *f, string name, Int start=0, Int n=-1);
+void gen_runfile54(stack *Stack)
+{
+  Int n=vm::pop<Int>(Stack,-1);
+  Int start=vm::pop<Int>(Stack,0);
+  string name=vm::pop<string>(Stack);
+  file * f=vm::pop<file *>(Stack);
+#line 572 "runfile.in"
+  {Stack->push<realarray*>(arrowfile(f)->reals(name,start,n)); return;}
+}
+
+// Return n rows of the named column of an Arrow file as integers, starting
+// at row start; null entries are read as 0.
+#line 578 "runfile.in"
+// Intarray* intcolumn(file *f, string name, Int start=0, Int n=-1);
+void gen_runfile55(stack *Stack)
+{
+  Int n=vm::pop<Int>(Stack,-1);
+  Int start=vm::pop<Int>(Stack,0);
+  string name=vm::pop<string>(Stack);
+  file * f=vm::pop<file *>(Stack);
+#line 579 "runfile.in"
+  {Stack->push<Intarray*>(arrowfile(f)->integers(name,start,n)); return;}
+}
+
+// Return n rows of the named column of an Arrow file as strings, starting
+// at row start; null entries are read as empty strings.
+#line 585 "runfile.in"
+// stringarray* stringcolumn(file *f, string name, Int start=0, Int n=-1);
+void gen_runfile56(stack *Stack)
+{
+  Int n=vm::pop<Int>(Stack,-1);
+  Int start=vm::pop<Int>(Stack,0);
+  string name=vm::pop<string>(Stack);
+  file * f=vm::pop<file *>(Stack);
+#line 586 "runfile.in"
+  {Stack->push<stringarray*>(arrowfile(f)->strings(name,start,n)); return;}
+}
+
+// Delete file named s.
+#line 591 "runfile.in"
+// Int delete(string s);
+void gen_runfile57(stack *Stack)
+{
+  string s=vm::pop<string>(Stack);
+#line 592 "runfile.in"
+  s=outpath(s);
+  shipoutwait();
+  Int rc=unlink(s.c_str());
+  if(rc == 0 && verbose > 0) 
+    cout << "Deleted " << s << endl;
+  {Stack->push<Int>(rc); return;}
+}
+
+// Rename file "from" to file "to".
+#line 602 "runfile.in"
+// Int rename(string from, string to);
+void gen_runfile58(stack *Stack)
+{
+  string to=vm::pop<string>(Stack);
+  string from=vm::pop<string>(Stack);
+#line 603 "runfile.in"
+  from=outpath(from);
+  to=outpath(to);
+  shipoutwait();
+  Int rc=rename(from.c_str(),to.c_str());
+  if(rc == 0 && verbose > 0) 
+    cout << "Renamed " << from << " to " << to << endl;
+  {Stack->push<Int>(rc); return;}
+}
+
+// Create a unique temporary file name.
+#line 614 "runfile.in"
+// string mktemp(string s);
+void gen_runfile59(stack *Stack)
+{
+  string s=vm::pop<string>(Stack);
+#line 615 "runfile.in"
+  char *S=Strdup(s+"XXXXXX");
+  int fd=mkstemp(S);
+  if(fd < 0) {
+    ostringstream buf;
+    buf << "Could not create unique temporary filename based on " << s;
+    error(buf);
+  }
+  {Stack->push<string>(S); return;}
+}
+
+} // namespace run
+
+namespace trans {
+
+void gen_runfile_venv(venv &ve)
+{
+#line 125 "runfile.in"
+  addFunc(ve, run::gen_runfile0, primBoolean(), SYM_EQ, formal(primFile(), SYM(a), false, false), formal(primFile(), SYM(b), false, false));
+#line 130 "runfile.in"
+  addFunc(ve, run::gen_runfile1, primBoolean(), SYM_NEQ, formal(primFile(), SYM(a), false, false), formal(primFile(), SYM(b), false, false));
+#line 135 "runfile.in"
+  REGISTER_BLTIN(run::nullFile,"nullFile");
+#line 140 "runfile.in"
+  addFunc(ve, run::gen_runfile3, primFile(), SYM(input), formal(primString() , SYM(name), true, false), formal(primBoolean(), SYM(check), true, false), formal(primString() , SYM(comment), true, false), formal(primString() , SYM(mode), true, false));
+#line 170 "runfile.in"
+  addFunc(ve, run::gen_runfile4, primFile(), SYM(output), formal(primString() , SYM(name), true, false), formal(primBoolean(), SYM(update), true, false), formal(primString() , SYM(comment), true, false), formal(primString() , SYM(mode), true, false));
+#line 207 "runfile.in"
+  addFunc(ve, run::gen_runfile5, primBoolean(), SYM(eof), formal(primFile(), SYM(f), false, false));
+#line 212 "runfile.in"
+  addFunc(ve, run::gen_runfile6, primBoolean(), SYM(eol), formal(primFile(), SYM(f), false, false));
+#line 217 "runfile.in"
+  addFunc(ve, run::gen_runfile7, primBoolean(), SYM(error), formal(primFile(), SYM(f), false, false));
+#line 222 "runfile.in"
+  addFunc(ve, run::gen_runfile8, primVoid(), SYM(clear), formal(primFile(), SYM(f), false, false));
+#line 227 "runfile.in"
+  addFunc(ve, run::gen_runfile9, primVoid(), SYM(close), formal(primFile(), SYM(f), false, false));
+#line 232 "runfile.in"
+  addFunc(ve, run::gen_runfile10, primInt(), SYM(precision), formal(primFile(), SYM(f), true, false), formal(primInt(), SYM(digits), true, false));
+#line 238 "runfile.in"
+  addFunc(ve, run::gen_runfile11, primVoid(), SYM(flush), formal(primFile(), SYM(f), false, false));
+#line 243 "runfile.in"
+  addFunc(ve, run::gen_runfile12, primString() , SYM(getc), formal(primFile(), SYM(f), false, false));
+#line 252 "runfile.in"
+  addFunc(ve, run::gen_runfile13, primInt(), SYM(tell), formal(primFile(), SYM(f), false, false));
+#line 257 "runfile.in"
+  addFunc(ve, run::gen_runfile14, primVoid(), SYM(seek), formal(primFile(), SYM(f), false, false), formal(primInt(), SYM(pos), false, false));
+#line 262 "runfile.in"
+  addFunc(ve, run::gen_runfile15, primVoid(), SYM(seekeof), formal(primFile(), SYM(f), false, false));
+#line 267 "runfile.in"
+  REGISTER_BLTIN(run::namePart,"namePart");
+#line 272 "runfile.in"
+  REGISTER_BLTIN(run::modePart,"modePart");
+#line 277 "runfile.in"
+  REGISTER_BLTIN(run::dimensionSetHelper,"dimensionSetHelper");
+#line 284 "runfile.in"
+  REGISTER_BLTIN(run::dimensionSet,"dimensionSet");
+#line 289 "runfile.in"
+  REGISTER_BLTIN(run::dimensionPart,"dimensionPart");
+#line 298 "runfile.in"
+  REGISTER_BLTIN(run::lineSetHelper,"lineSetHelper");
+#line 305 "runfile.in"
+  REGISTER_BLTIN(run::lineSet,"lineSet");
+#line 310 "runfile.in"
+  REGISTER_BLTIN(run::linePart,"linePart");
+#line 315 "runfile.in"
+  REGISTER_BLTIN(run::csvSetHelper,"csvSetHelper");
+#line 322 "runfile.in"
+  REGISTER_BLTIN(run::csvSet,"csvSet");
+#line 327 "runfile.in"
+  REGISTER_BLTIN(run::csvPart,"csvPart");
+#line 332 "runfile.in"
+  REGISTER_BLTIN(run::wordSetHelper,"wordSetHelper");
+#line 339 "runfile.in"
+  REGISTER_BLTIN(run::wordSet,"wordSet");
+#line 344 "runfile.in"
+  REGISTER_BLTIN(run::wordPart,"wordPart");
+#line 349 "runfile.in"
+  REGISTER_BLTIN(run::singlerealSetHelper,"singlerealSetHelper");
+#line 356 "runfile.in"
+  REGISTER_BLTIN(run::singlerealSet,"singlerealSet");
+#line 361 "runfile.in"
+  REGISTER_BLTIN(run::singlerealPart,"singlerealPart");
+#line 366 "runfile.in"
+  REGISTER_BLTIN(run::singleintSetHelper,"singleintSetHelper");
+#line 373 "runfile.in"
+  REGISTER_BLTIN(run::singleintSet,"singleintSet");
+#line 378 "runfile.in"
+  REGISTER_BLTIN(run::singleintPart,"singleintPart");
+#line 383 "runfile.in"
+  REGISTER_BLTIN(run::signedintSetHelper,"signedintSetHelper");
+#line 390 "runfile.in"
+  REGISTER_BLTIN(run::signedintSet,"signedintSet");
+#line 395 "runfile.in"
+  REGISTER_BLTIN(run::signedintPart,"signedintPart");
+#line 400 "runfile.in"
+  REGISTER_BLTIN(run::prefetchSetHelper,"prefetchSetHelper");
+#line 407 "runfile.in"
+  REGISTER_BLTIN(run::prefetchSet,"prefetchSet");
+#line 412 "runfile.in"
+  REGISTER_BLTIN(run::prefetchPart,"prefetchPart");
+#line 417 "runfile.in"
+  REGISTER_BLTIN(run::readSetHelper,"readSetHelper");
+#line 440 "runfile.in"
+  REGISTER_BLTIN(run::readSet,"readSet");
+#line 445 "runfile.in"
+  addFunc(ve, run::gen_runfile44, realArray2(), SYM(readrows), formal(primFile(), SYM(f), false, false), formal(primInt(), SYM(n), false, false));
+#line 469 "runfile.in"
+  addFunc(ve, run::gen_runfile45, primVoid(), SYM(writerows), formal(primFile(), SYM(f), false, false), formal(realArray2(), SYM(a), false, false), formal(primString() , SYM(separator), true, false), formal(primBoolean(), SYM(async), true, false));
+#line 478 "runfile.in"
+  addFunc(ve, run::gen_runfile46, primVoid(), SYM(writerows), formal(primFile(), SYM(f), false, false), formal(IntArray2(), SYM(a), false, false), formal(primString() , SYM(separator), true, false), formal(primBoolean(), SYM(async), true, false));
+#line 484 "runfile.in"
+  addFunc(ve, run::gen_runfile47, realArray(), SYM(min), formal(primFile(), SYM(f), false, false));
+#line 490 "runfile.in"
+  addFunc(ve, run::gen_runfile48, realArray(), SYM(max), formal(primFile(), SYM(f), false, false));
+#line 496 "runfile.in"
+  addFunc(ve, run::gen_runfile49, realArray(), SYM(sum), formal(primFile(), SYM(f), false, false));
+#line 502 "runfile.in"
+  addFunc(ve, run::gen_runfile50, IntArray(), SYM(frequency), formal(primFile(), SYM(f), false, false), formal(primReal(), SYM(a), false, false), formal(primReal(), SYM(b), false, false), formal(primInt(), SYM(n), false, false));
+#line 524 "runfile.in"
+  addFunc(ve, run::gen_runfile51, IntArray2(), SYM(frequency), formal(primFile(), SYM(f), false, false), formal(primPair(), SYM(a), false, true), formal(primPair(), SYM(b), false, true), formal(primInt(), SYM(nx), false, false), formal(primInt(), SYM(ny), true, false));
+#line 557 "runfile.in"
+  addFunc(ve, run::gen_runfile52, stringArray(), SYM(columns), formal(primFile(), SYM(f), false, false));
+#line 563 "runfile.in"
+  addFunc(ve, run::gen_runfile53, primInt(), SYM(length), formal(primFile(), SYM(f), false, false));
+#line 569 "runfile.in"
+  addFunc(ve, run::gen_runfile54, realArray(), SYM(realcolumn), formal(primFile(), SYM(f), false, false), formal(primString() , SYM(name), false, false), formal(primInt(), SYM(start), true, false), formal(primInt(), SYM(n), true, false));
+#line 576 "runfile.in"
+  addFunc(ve, run::gen_runfile55, IntArray(), SYM(intcolumn), formal(primFile(), SYM(f), false, false), formal(primString() , SYM(name), false, false), formal(primInt(), SYM(start), true, false), formal(primInt(), SYM(n), true, false));
+#line 583 "runfile.in"
+  addFunc(ve, run::gen_runfile56, stringArray(), SYM(stringcolumn), formal(primFile(), SYM(f), false, false), formal(primString() , SYM(name), false, false), formal(primInt(), SYM(start), true, false), formal(primInt(), SYM(n), true, false));
+#line 590 "runfile.in"
+  addFunc(ve, run::gen_runfile57, primInt(), SYM(delete), formal(primString() , SYM(s), false, false));
+#line 601 "runfile.in"
+  addFunc(ve, run::gen_runfile58, primInt(), SYM(rename), formal(primString() , SYM(from), false, false), formal(primString() , SYM(to), false, false));
+#line 613 "runfile.in"
+  addFunc(ve, run::gen_runfile59, primString() , SYM(mktemp), formal(primString() , SYM(s), false, false));
+}
+
+} // namespace trans
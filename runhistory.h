@@ -0,0 +1,8 @@
+/***** Autogenerated from runhistory.in; changes will be overwritten *****/
+
+#ifndef runhistory_H
+#define runhistory_H
+namespace run {
+}
+
+#endif // runhistory_H
@@ -0,0 +1,795 @@
+/***** Autogenerated from runlabel.in; changes will be overwritten *****/
+
+#line 1 "runtimebase.in"
+/*****
+ * runtimebase.in
+ * Andy Hammerlindl  2009/07/28
+ *
+ * Common declarations needed for all code-generating .in files.
+ *
+ *****/
+
+
+#line 1 "runlabel.in"
+/*****
+ * runlabel.in
+ *
+ * Runtime functions for label operations.
+ *
+ *****/
+
+#line 1 "runtimebase.in"
+#include "stack.h"
+#include "types.h"
+#include "builtin.h"
+#include "entry.h"
+#include "errormsg.h"
+#include "array.h"
+#include "triple.h"
+#include "callable.h"
+#include "opsymbols.h"
+
+using vm::stack;
+using vm::error;
+using vm::array;
+using vm::read;
+using vm::callable;
+using types::formal;
+using types::function;
+using camp::triple;
+
+#define PRIMITIVE(name,Name,asyName) using types::prim##Name;
+#include <primitives.h>
+#undef PRIMITIVE
+
+typedef double real;
+
+void unused(void *);
+
+namespace run {
+array *copyArray(array *a);
+array *copyArray2(array *a);
+array *copyArray3(array *a);
+
+double *copyTripleArray2Components(array *a, size_t &N,
+                                   GCPlacement placement=NoGC);
+triple *copyTripleArray2C(array *a, size_t &N,
+                          GCPlacement placement=NoGC);
+}
+
+function *realRealFunction();
+
+#define CURRENTPEN processData().currentpen
+
+#line 19 "runlabel.in"
+#include <sys/stat.h>
+
+#include "picture.h"
+#include "drawlabel.h"
+#include "locate.h"
+#include "outline.h"
+
+using namespace camp;
+using namespace vm;
+using namespace settings;
+
+typedef array realarray;
+typedef array stringarray;
+typedef array penarray;
+typedef array patharray;
+typedef array patharray2;
+
+using types::realArray;
+using types::stringArray;
+using types::penArray;
+using types::pathArray;
+using types::pathArray2;
+
+void cannotread(const string& s) 
+{
+  ostringstream buf;
+  buf << "Cannot read from " << s;
+  error(buf);
+}
+
+void cannotwrite(const string& s) 
+{
+  ostringstream buf;
+  buf << "Cannot write to " << s;
+  error(buf);
+}
+
+pair readpair(stringstream& s, double hscale=1.0, double vscale=1.0)
+{
+  double x,y;
+  s >> y;
+  s >> x;
+  return pair(hscale*x,vscale*y);
+}
+
+string ASYx="/ASYx {( ) print ASYX sub 12 string cvs print} bind def";
+string ASYy="/ASYy {( ) print ASYY sub 12 string cvs print} bind def";
+string pathforall="{(M) print ASYy ASYx} {(L) print ASYy ASYx} {(C) print ASYy ASYx ASYy ASYx ASYy ASYx} {(c) print} pathforall";
+string currentpoint="print currentpoint ASYy ASYx ";
+string ASYinit="/ASYX currentpoint pop def /ASYY currentpoint exch pop def ";
+string ASY1="ASY1 {"+ASYinit+"/ASY1 false def} if ";
+
+void endpath(std::ostream& ps) 
+{
+  ps << ASY1 << pathforall << " (M) " << currentpoint
+     << "currentpoint newpath moveto} bind def" << endl;
+}
+
+void fillpath(std::ostream& ps)
+{
+  ps << "/fill {closepath ";
+  endpath(ps);
+}
+
+void showpath(std::ostream& ps) 
+{
+  ps << ASYx << newl
+     << ASYy << newl
+     << "/ASY1 true def" << newl
+     << "/stroke {strokepath ";
+  endpath(ps);
+  fillpath(ps);
+}
+
+array *readpath(const string& psname, bool keep, bool pdf=false,
+                double hscale=1.0, double vsign=1.0)
+{
+  double vscale=vsign*hscale;
+  array *PP=new array(0);
+
+  char *oldPath=NULL;
+  string dir=stripFile(outname());
+  if(!dir.empty()) {
+    oldPath=getPath();
+    setPath(dir.c_str());
+  }
+
+  mem::vector<string> cmd;
+  cmd.push_back(getSetting<string>("gs"));
+  cmd.push_back("-q");
+  cmd.push_back("-dBATCH");
+  cmd.push_back("-P");
+  if(safe) cmd.push_back("-dSAFER");
+#ifdef __MSDOS__
+  const string null="NUL";
+#else
+  const string null="/dev/null";
+#endif
+  string epsdriver=getSetting<string>("epsdriver");
+  cmd.push_back("-sDEVICE="+epsdriver);
+  cmd.push_back("-sOutputFile="+null);
+  cmd.push_back(stripDir(psname));
+  iopipestream gs(cmd,"gs","Ghostscript");
+  while(gs.running()) {
+    stringstream buf;
+    string s=gs.readline();
+    if(s.empty()) break;
+    if(!pdf) gs << newl;
+
+// Workaround broken stringstream container in MacOS 10.9 libc++.
+#if defined(__APPLE__) || defined(__FreeBSD__) || defined(__FreeBSD_kernel__ )
+    for(string::iterator i=s.begin(); i != s.end(); ++i) {
+      if(isalpha(*i) && *i != 'e') {buf << " ";}
+      buf << *i;
+    }
+#else    
+    buf << s;
+#endif
+    
+    if(verbose > 2) cout << endl;
+  
+    array *P=new array(0);
+    PP->push(P);
+    pathbuilder builder(P);
+    
+    while(!buf.eof()) {
+      char c;
+      buf >> c;
+      if(c == '>') break;
+
+      switch(c) {
+        case 'M':
+          builder.moveto(readpair(buf,hscale,vscale));
+          break;
+        case 'L':
+          builder.lineto(readpair(buf,hscale,vscale));
+          break;
+        case 'C':
+        {
+          pair point=readpair(buf,hscale,vscale);
+          pair pre=readpair(buf,hscale,vscale);
+          pair post=readpair(buf,hscale,vscale);
+          builder.curveto(post,pre,point);
+          break;
+        }
+        case 'c':
+          builder.closepath();
+          break;
+      }
+    }
+  }
+  
+  if(oldPath != NULL)
+    setPath(oldPath);
+  
+  if(!keep)
+    unlink(psname.c_str());
+  return PP;
+}
+
+// Outline the strings s in the fonts p with TeX.
+array *texpaths(array *s, array *p)
+{
+  size_t n=checkArrays(s,p);
+  
+  string prefix=cleanpath(outname());
+  string psname=auxname(prefix,"ps");
+  string texname=auxname(prefix,"tex");
+  string dviname=auxname(prefix,"dvi");
+  bbox b;
+  string texengine=getSetting<string>("tex");
+  bool xe=settings::xe(texengine) || settings::context(texengine);
+  texfile tex(texname,b,true);
+  tex.miniprologue();
+  
+  for(size_t i=0; i < n; ++i) {
+    tex.setfont(read<pen>(p,i));
+    if(i != 0) {
+      if(texengine == "context")
+        tex.verbatimline("}\\page\\hbox{%");
+      else if(texengine == "luatex" || texengine == "tex" ||
+              texengine == "pdftex")
+        tex.verbatimline("\\eject");
+      else
+        tex.verbatimline("\\newpage");
+    }
+    if(!xe) {
+      tex.verbatimline("\\special{ps:");
+      tex.verbatimline(ASYx);
+      tex.verbatimline(ASYy);
+      tex.verbatimline("/ASY1 true def");
+      tex.verbatimline("/show {"+ASY1+
+                       "currentpoint newpath moveto false charpath "+pathforall+
+                       "} bind def");
+      tex.verbatimline("/V {"+ASY1+"Ry neg Rx 4 copy 4 2 roll 2 copy 6 2 roll 2 copy (M) print ASYy ASYx (L) print ASYy add ASYx (L) print add ASYy add ASYx (L) print add ASYy ASYx (c) print} bind def}");
+    }
+    tex.verbatimline(read<string>(s,i)+"\\ %");
+  }
+  
+  tex.epilogue(true);
+  tex.close();
+  
+  int status=opentex(texname,prefix,!xe);
+  
+  string pdfname,pdfname2,psname2;
+  bool keep=getSetting<bool>("keep");
+  
+  bool legacygs=false;
+  array *outlined=NULL;
+  if(!status) {
+    if(xe) {
+// Use legacy ghostscript driver for gs-9.13 and earlier.
+      string epsdriver=getSetting<string>("epsdriver");
+      legacygs=epsdriver == "epswrite";
+
+      pdfname=auxname(prefix,"pdf");
+      pdfname2=auxname(prefix+"_","pdf");
+      psname2=auxname(prefix+"_","ps");
+      if(!fs::exists(pdfname)) return new array(n);
+      std::ofstream ps(psname.c_str(),std::ios::binary);
+      if(!ps) cannotwrite(psname);
+      
+      showpath(ps);
+
+      mem::vector<string> pcmd;
+      pcmd.push_back(getSetting<string>("gs"));
+      pcmd.push_back("-q");
+      pcmd.push_back("-dNOCACHE");
+      pcmd.push_back("-dNOPAUSE");
+      pcmd.push_back("-dBATCH");
+      if(safe) pcmd.push_back("-dSAFER");
+      pcmd.push_back("-sDEVICE=pdfwrite");
+      pcmd.push_back("-sOutputFile="+pdfname2);
+      pcmd.push_back(pdfname);
+      status=System(pcmd,0,true,"gs");
+      if(status == 0) {
+        mem::vector<string> cmd;
+        cmd.push_back(getSetting<string>("gs"));
+        cmd.push_back("-q");
+        cmd.push_back("-dNOCACHE");
+        cmd.push_back("-dNOPAUSE");
+        cmd.push_back("-dBATCH");
+        if(safe) cmd.push_back("-dSAFER");
+        cmd.push_back("-sDEVICE="+epsdriver);
+        // Work around eps2write bug that forces all postscript to first page.
+        cmd.push_back("-sOutputFile="+psname2+(legacygs ? "" : "%d"));
+        cmd.push_back(pdfname2);
+        status=System(cmd,0,true,"gs");
+
+        if(legacygs) {
+          std::ifstream in(psname2.c_str());
+          ps << in.rdbuf();
+        } else {
+          for(unsigned int i=1; i <= n ; ++i) {
+            ostringstream buf;
+            buf << psname2 << i;
+            const string& s=buf.str();
+            const char *name=s.c_str();
+            std::ifstream in(name,std::ios::binary);
+            ps << in.rdbuf();
+            ps << "(>\n) print flush\n";
+            in.close();
+            if(!keep) unlink(name);
+          }
+        }
+        ps.close();
+      }
+    } else {
+      if(!fs::exists(dviname)) return new array(n);
+      outlineprovider *provider=outliner();
+      if(provider) {
+        array *PP=new array(0);
+        if(provider->dvi(dviname,PP) && PP->size() == n)
+          outlined=PP;
+      }
+    }
+    if(!xe && !outlined) {
+      mem::vector<string> dcmd;
+      dcmd.push_back(getSetting<string>("dvips"));
+      dcmd.push_back("-R");
+      dcmd.push_back("-Pdownload35");
+      dcmd.push_back("-D600");
+      push_split(dcmd,getSetting<string>("dvipsOptions"));
+      if(verbose <= 2) dcmd.push_back("-q");
+      dcmd.push_back("-o"+psname);
+      dcmd.push_back(dviname);
+      status=System(dcmd,0,true,"dvips");
+    }
+  } else
+    error("texpath failed");
+    
+  if(!keep) { // Delete temporary files.
+    unlink(texname.c_str());
+    if(!getSetting<bool>("keepaux"))
+      unlink(auxname(prefix,"aux").c_str());
+    unlink(auxname(prefix,"log").c_str());
+    if(xe) {
+      unlink(pdfname.c_str());
+      unlink(pdfname2.c_str());
+    } else
+      unlink(dviname.c_str());
+    if(settings::context(texengine)) {
+      unlink(auxname(prefix,"top").c_str());
+      unlink(auxname(prefix,"tua").c_str());
+      unlink(auxname(prefix,"tuc").c_str());
+      unlink(auxname(prefix,"tui").c_str());
+    }
+  }
+  if(outlined) return outlined;
+  return xe ? readpath(psname,keep,!legacygs,0.1) : 
+    readpath(psname,keep,false,0.12,-1.0);
+}
+
+// Outline the strings s in the fonts p with the textcommand typesetter.
+array *textpaths(array *s, array *p)
+{
+  size_t n=checkArrays(s,p);
+  
+  string prefix=cleanpath(outname());
+  string outputname=auxname(prefix,getSetting<string>("textoutformat"));
+
+  string textname=auxname(prefix,getSetting<string>("textextension"));
+  std::ofstream text(textname.c_str());
+  
+  if(!text) cannotwrite(textname);
+
+  for(size_t i=0; i < n; ++i) {
+    text << getSetting<string>("textprologue") << newl
+         << read<pen>(p,i).Font() << newl
+         << read<string>(s,i) << newl
+         << getSetting<string>("textepilogue") << endl;
+  }
+  text.close();
+  
+  string psname=auxname(prefix,"ps");
+  std::ofstream ps(psname.c_str());
+  if(!ps) cannotwrite(psname);
+
+  showpath(ps);
+  
+  mem::vector<string> cmd;
+  cmd.push_back(getSetting<string>("textcommand"));
+  push_split(cmd,getSetting<string>("textcommandOptions"));
+  cmd.push_back(textname);
+  iopipestream typesetter(cmd);
+  typesetter.block(true,false);
+  
+  mem::vector<string> cmd2;
+  cmd2.push_back(getSetting<string>("gs"));
+  cmd2.push_back("-q");
+  cmd2.push_back("-dNOCACHE");
+  cmd2.push_back("-dNOPAUSE");
+  cmd2.push_back("-dBATCH");
+  cmd2.push_back("-P");
+  if(safe) cmd2.push_back("-dSAFER");
+  cmd2.push_back("-sDEVICE="+getSetting<string>("epsdriver"));
+  cmd2.push_back("-sOutputFile=-");
+  cmd2.push_back("-");
+  iopipestream gs(cmd2,"gs","Ghostscript");
+  gs.block(false,false);
+
+  // TODO: Simplify by connecting the pipes directly.
+  while(true) {
+    string out;
+    if(typesetter.isopen()) {
+      typesetter >> out;
+      if(!out.empty()) gs << out;
+      else if(!typesetter.running()) {
+        typesetter.pipeclose();
+        gs.eof();
+      }
+    } 
+    string out2;
+    gs >> out2;
+    if(out2.empty() && !gs.running()) break;
+    ps << out2;
+  }
+  ps.close();
+  
+  if(verbose > 2) cout << endl;
+  
+  bool keep=getSetting<bool>("keep");
+  if(!keep) // Delete temporary files.
+    unlink(textname.c_str());
+  return readpath(psname,keep,false,0.1);
+}
+
+// Outlines are cached in memory and, if the texpathcache setting is true,
+// in the texpath subdirectory of the configuration directory, indexed by
+// the string, its font, and the environment in which it was typeset. Only
+// local files read by the preamble are tracked, so the disk cache is opt-in.
+typedef array *outlinefunction(array *s, array *p);
+mem::map<CONST string,array *> outlinecache;
+
+const char *outlineheader="%Asymptote outline cache 1";
+
+string outlinekey(const string& environment, const string& s, const pen& p)
+{
+  ostringstream buf;
+  buf.precision(17);
+  buf << environment << newl << p.Font() << newl << p.size() << " "
+      << p.Lineskip() << newl << s;
+  return buf.str();
+}
+
+// Append to buf the modification time of each file in the current directory
+// that the preamble reads with \input, \include, \usepackage, or
+// \RequirePackage, so that cached outlines are not reused once a local
+// macro or style file changes.
+void inputtimes(ostream& buf, const string& preamble)
+{
+  static const char *commands[]={"\\input","\\include","\\usepackage",
+                                 "\\RequirePackage"};
+  static const char *suffixes[]={"",".tex",".sty"};
+  for(size_t c=0; c < sizeof(commands)/sizeof(char *); ++c) {
+    string command=commands[c];
+    for(size_t pos=preamble.find(command); pos != string::npos;
+        pos=preamble.find(command,pos)) {
+      pos += command.size();
+      if(pos < preamble.size() && isalpha(preamble[pos])) continue;
+      size_t i=preamble.find_first_not_of(" \t\n",pos);
+      if(i != string::npos && preamble[i] == '[') {
+        i=preamble.find(']',i);
+        if(i != string::npos) i=preamble.find_first_not_of(" \t\n",i+1);
+      }
+      if(i == string::npos) break;
+      string names;
+      if(preamble[i] == '{') {
+        size_t end=preamble.find('}',i);
+        if(end == string::npos) break;
+        names=preamble.substr(i+1,end-i-1);
+      } else
+        names=preamble.substr(i,preamble.find_first_of(" \t\n%\\",i)-i);
+      istringstream list(names);
+      string name;
+      while(getline(list,name,',')) {
+        size_t first=name.find_first_not_of(" \t\n");
+        if(first == string::npos) continue;
+        name=name.substr(first,name.find_last_not_of(" \t\n")-first+1);
+        for(size_t k=0; k < sizeof(suffixes)/sizeof(char *); ++k) {
+          struct stat st;
+          string file=name+suffixes[k];
+          if(stat(file.c_str(),&st) == 0 && S_ISREG(st.st_mode)) {
+            buf << file << " " << st.st_mtime << newl;
+            break;
+          }
+        }
+      }
+    }
+  }
+}
+
+string outlinename(const string& key)
+{
+  // 64-bit FNV-1a hash; the file records the full key to detect collisions.
+  unsigned long long h=14695981039346656037ULL;
+  for(size_t i=0; i < key.size(); ++i) {
+    h ^= (unsigned char) key[i];
+    h *= 1099511628211ULL;
+  }
+  ostringstream buf;
+  buf << initdir << dirsep << "texpath" << dirsep << std::hex
+      << std::setfill('0') << std::setw(16) << h;
+  return buf.str();
+}
+
+array *readoutline(const string& key)
+{
+  std::ifstream in(outlinename(key).c_str(),std::ios::binary);
+  if(!in) return NULL;
+  string header;
+  getline(in,header);
+  size_t length;
+  if(header != outlineheader || !(in >> length) || in.get() != '\n')
+    return NULL;
+  string k(length,' ');
+  if(!in.read(&k[0],length) || k != key) return NULL;
+
+  size_t npaths;
+  if(!(in >> npaths)) return NULL;
+  array *P=new array(npaths);
+  for(size_t i=0; i < npaths; ++i) {
+    size_t n;
+    bool cyclic;
+    if(!(in >> n >> cyclic)) return NULL;
+    mem::vector<solvedKnot> nodes(n);
+    for(size_t j=0; j < n; ++j) {
+      double x[6];
+      solvedKnot& node=nodes[j];
+      for(size_t l=0; l < 6; ++l) in >> x[l];
+      in >> node.straight;
+      node.pre=pair(x[0],x[1]);
+      node.point=pair(x[2],x[3]);
+      node.post=pair(x[4],x[5]);
+    }
+    if(!in) return NULL;
+    (*P)[i]=n > 0 ? path(nodes,n,cyclic) : path();
+  }
+  return P;
+}
+
+void writeoutline(const string& key, array *P)
+{
+  string name=outlinename(key);
+  string tmpname=name+".tmp";
+  std::ofstream out(tmpname.c_str(),std::ios::binary);
+  if(!out) {
+    string dir=initdir+dirsep+"texpath";
+    if(mkdir(dir.c_str(),0777) != 0 && errno != EEXIST) return;
+    out.open(tmpname.c_str(),std::ios::binary);
+    if(!out) return;
+  }
+  out.precision(17);
+  size_t npaths=P->size();
+  out << outlineheader << newl << key.size() << newl << key << newl
+      << npaths << newl;
+  for(size_t i=0; i < npaths; ++i) {
+    path g=read<path>(P,i);
+    Int n=g.size();
+    out << n << " " << g.cyclic() << newl;
+    for(Int j=0; j < n; ++j) {
+      pair pre=g.precontrol(j);
+      pair point=g.point(j);
+      pair post=g.postcontrol(j);
+      out << pre.getx() << " " << pre.gety() << " "
+          << point.getx() << " " << point.gety() << " "
+          << post.getx() << " " << post.gety() << " " << g.straight(j)
+          << newl;
+    }
+  }
+  out.close();
+  if(out) rename(tmpname.c_str(),name.c_str());
+  else unlink(tmpname.c_str());
+}
+
+// Return the outlines of the strings s in the fonts p, typesetting
+// all of those not already cached with a single call to typeset.
+array *outlines(array *s, array *p, const string& environment,
+                outlinefunction *typeset)
+{
+  size_t n=checkArrays(s,p);
+  array *PP=new array(n);
+  if(n == 0) return PP;
+
+  bool disk=getSetting<bool>("texpathcache") && !initdir.empty();
+  mem::vector<string> keys(n);
+  mem::map<CONST string,size_t> missing;
+  mem::vector<size_t> index(n);
+  array *S=new array(0);
+  array *Pens=new array(0);
+
+  for(size_t i=0; i < n; ++i) {
+    const string& si=read<string>(s,i);
+    pen pi=read<pen>(p,i);
+    string& key=keys[i]=outlinekey(environment,si,pi);
+    mem::map<CONST string,array *>::iterator c=outlinecache.find(key);
+    array *P=c != outlinecache.end() ? c->second : NULL;
+    if(!P && disk && (P=readoutline(key)))
+      outlinecache[key]=P;
+    if(P)
+      // Callers may modify the result.
+      (*PP)[i]=new array(*P);
+    else {
+      mem::map<CONST string,size_t>::iterator m=missing.find(key);
+      if(m == missing.end()) {
+        index[i]=missing[key]=S->size();
+        S->push(si);
+        Pens->push(pi);
+      } else index[i]=m->second;
+    }
+  }
+
+  if(S->size() > 0) {
+    array *G=typeset(S,Pens);
+    size_t m=G->size();
+    for(size_t i=0; i < n; ++i) {
+      if(!(*PP)[i].empty()) continue;
+      size_t j=index[i];
+      if(j >= m || (*G)[j].empty()) continue;
+      array *P=read<array *>(G,j);
+      const string& key=keys[i];
+      if(outlinecache.find(key) == outlinecache.end()) {
+        outlinecache[key]=new array(*P);
+        if(disk) writeoutline(key,P);
+      }
+      (*PP)[i]=new array(*P);
+    }
+  }
+  return PP;
+}
+// Autogenerated routines:
+
+
+
+#ifndef NOSYM
+#include "runlabel.symbols.h"
+
+#endif
+namespace run {
+#line 612 "runlabel.in"
+// void label(picture *f, string *s, string *size, transform t, pair position,           pair align, pen p);
+void gen_runlabel0(stack *Stack)
+{
+  pen p=vm::pop<pen>(Stack);
+  pair align=vm::pop<pair>(Stack);
+  pair position=vm::pop<pair>(Stack);
+  transform t=vm::pop<transform>(Stack);
+  string * size=vm::pop<string *>(Stack);
+  string * s=vm::pop<string *>(Stack);
+  picture * f=vm::pop<picture *>(Stack);
+#line 614 "runlabel.in"
+  f->append(new drawLabel(*s,*size,t,position,align,p));
+}
+
+#line 618 "runlabel.in"
+// bool labels(picture *f);
+void gen_runlabel1(stack *Stack)
+{
+  picture * f=vm::pop<picture *>(Stack);
+#line 619 "runlabel.in"
+  {Stack->push<bool>(f->havelabels()); return;}
+}
+
+#line 623 "runlabel.in"
+// realarray* texsize(string *s, pen p=CURRENTPEN);
+void gen_runlabel2(stack *Stack)
+{
+  pen p=vm::pop<pen>(Stack,CURRENTPEN);
+  string * s=vm::pop<string *>(Stack);
+#line 624 "runlabel.in"
+  texinit();
+  processDataStruct &pd=processData();
+  
+  string texengine=getSetting<string>("tex");
+  setpen(pd.tex,texengine,p);
+  
+  double width,height,depth;
+  texbounds(width,height,depth,pd.tex,*s);
+  
+  array *t=new array(3);
+  (*t)[0]=width;
+  (*t)[1]=height;
+  (*t)[2]=depth;
+  {Stack->push<realarray*>(t); return;}
+}
+
+#line 641 "runlabel.in"
+// patharray2* _texpath(stringarray *s, penarray *p);
+void gen_runlabel3(stack *Stack)
+{
+  penarray * p=vm::pop<penarray *>(Stack);
+  stringarray * s=vm::pop<stringarray *>(Stack);
+#line 642 "runlabel.in"
+  string texengine=getSetting<string>("tex");
+  ostringstream environment;
+  environment << texengine << newl << texcommand() << newl
+              << getSetting<string>("dvipsOptions") << newl
+              << getSetting<bool>("freetype") << newl;
+  ostringstream preamble;
+  texuserpreamble(preamble);
+  environment << preamble.str();
+  inputtimes(environment,preamble.str());
+  {Stack->push<patharray2*>(outlines(s,p,environment.str(),texpaths)); return;}
+}
+
+#line 656 "runlabel.in"
+// patharray2* textpath(stringarray *s, penarray *p);
+void gen_runlabel4(stack *Stack)
+{
+  penarray * p=vm::pop<penarray *>(Stack);
+  stringarray * s=vm::pop<stringarray *>(Stack);
+#line 657 "runlabel.in"
+  ostringstream environment;
+  environment << getSetting<string>("textcommand") << newl
+              << getSetting<string>("textcommandOptions") << newl
+              << getSetting<string>("textprologue") << newl
+              << getSetting<string>("textepilogue");
+  {Stack->push<patharray2*>(outlines(s,p,environment.str(),textpaths)); return;}
+}
+
+#line 667 "runlabel.in"
+// patharray* _strokepath(path g, pen p=CURRENTPEN);
+void gen_runlabel5(stack *Stack)
+{
+  pen p=vm::pop<pen>(Stack,CURRENTPEN);
+  path g=vm::pop<path>(Stack);
+#line 668 "runlabel.in"
+  array *P=new array(0);
+  if(g.size() == 0) {Stack->push<patharray*>(P); return;}
+  
+  string prefix=cleanpath(outname());
+  string psname=auxname(prefix,"ps");
+  bbox b;
+  psfile ps(psname,false);
+  ps.prologue(b);
+  ps.verbatimline(ASYx);
+  ps.verbatimline(ASYy);
+  ps.verbatimline("/stroke {"+ASYinit+pathforall+"} bind def");
+  ps.resetpen();
+  ps.setpen(p);
+  ps.write(g);
+  ps.strokepath();
+  ps.stroke(p);
+  ps.verbatimline("(M) "+currentpoint);
+  ps.epilogue();
+  ps.close();
+  array *a=readpath(psname,getSetting<bool>("keep"));
+  {Stack->push<patharray*>(a->size() > 0 ? read<array *>(a,0) : a); return;}
+}
+
+} // namespace run
+
+namespace trans {
+
+void gen_runlabel_venv(venv &ve)
+{
+#line 612 "runlabel.in"
+  addFunc(ve, run::gen_runlabel0, primVoid(), SYM(label), formal(primPicture(), SYM(f), false, false), formal(primString(), SYM(s), false, false), formal(primString(), SYM(size), false, false), formal(primTransform(), SYM(t), false, false), formal(primPair(), SYM(position), false, false), formal(primPair(), SYM(align), false, false), formal(primPen(), SYM(p), false, false));
+#line 618 "runlabel.in"
+  addFunc(ve, run::gen_runlabel1, primBoolean(), SYM(labels), formal(primPicture(), SYM(f), false, false));
+#line 623 "runlabel.in"
+  addFunc(ve, run::gen_runlabel2, realArray(), SYM(texsize), formal(primString(), SYM(s), false, false), formal(primPen(), SYM(p), true, false));
+#line 641 "runlabel.in"
+  addFunc(ve, run::gen_runlabel3, pathArray2() , SYM(_texpath), formal(stringArray() , SYM(s), false, false), formal(penArray() , SYM(p), false, false));
+#line 656 "runlabel.in"
+  addFunc(ve, run::gen_runlabel4, pathArray2() , SYM(textpath), formal(stringArray() , SYM(s), false, false), formal(penArray() , SYM(p), false, false));
+#line 667 "runlabel.in"
+  addFunc(ve, run::gen_runlabel5, pathArray() , SYM(_strokepath), formal(primPath(), SYM(g), false, false), formal(primPen(), SYM(p), true, false));
+}
+
+} // namespace trans
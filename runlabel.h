@@ -0,0 +1,8 @@
+/***** Autogenerated from runlabel.in; changes will be overwritten *****/
+
+#ifndef runlabel_H
+#define runlabel_H
+namespace run {
+}
+
+#endif // runlabel_H
@@ -0,0 +1,1636 @@
+/***** Autogenerated from runpicture.in; changes will be overwritten *****/
+
+#line 1 "runtimebase.in"
+/*****
+ * runtimebase.in
+ * Andy Hammerlindl  2009/07/28
+ *
+ * Common declarations needed for all code-generating .in files.
+ *
+ *****/
+
+
+#line 1 "runpicture.in"
+/*****
+ * runpicture.in
+ *
+ * Runtime functions for picture operations.
+ *
+ *****/
+
+#line 1 "runtimebase.in"
+#include "stack.h"
+#include "types.h"
+#include "builtin.h"
+#include "entry.h"
+#include "errormsg.h"
+#include "array.h"
+#include "triple.h"
+#include "callable.h"
+#include "opsymbols.h"
+
+using vm::stack;
+using vm::error;
+using vm::array;
+using vm::read;
+using vm::callable;
+using types::formal;
+using types::function;
+using camp::triple;
+
+#define PRIMITIVE(name,Name,asyName) using types::prim##Name;
+#include <primitives.h>
+#undef PRIMITIVE
+
+typedef double real;
+
+void unused(void *);
+
+namespace run {
+array *copyArray(array *a);
+array *copyArray2(array *a);
+array *copyArray3(array *a);
+
+double *copyTripleArray2Components(array *a, size_t &N,
+                                   GCPlacement placement=NoGC);
+triple *copyTripleArray2C(array *a, size_t &N,
+                          GCPlacement placement=NoGC);
+}
+
+function *realRealFunction();
+
+#define CURRENTPEN processData().currentpen
+
+#line 31 "runpicture.in"
+#include "picture.h"
+#include "drawelement.h"
+#include "path.h"
+#include "array.h"
+#include "arrayop.h"
+#include "drawpath.h"
+#include "drawfill.h"
+#include "drawclipbegin.h"
+#include "drawclipend.h"
+#include "drawgsave.h"
+#include "drawgrestore.h"
+#include "drawgroup.h"
+#include "drawverbatim.h"
+#include "drawlabel.h"
+#include "drawlayer.h"
+#include "drawsimplify.h"
+#include "drawimage.h"
+#include "drawpath3.h"
+#include "drawsurface.h"
+
+#include <algorithm>
+
+using namespace camp;
+using namespace settings;
+using namespace vm;
+
+typedef array Intarray;
+typedef array Intarray2;
+typedef array realarray;
+typedef array realarray2;
+typedef array pairarray;
+typedef array pairarray2;
+typedef array triplearray;
+typedef array triplearray2;
+typedef array triplearray3;
+typedef array patharray;
+typedef array penarray;
+typedef array penarray2;
+
+typedef callable callableTransform;
+typedef callable callablePen;
+typedef callable callableRealReal;
+
+using types::IntArray;
+using types::IntArray2;
+using types::realArray;
+using types::realArray2;
+using types::pairArray;
+using types::pairArray2;
+using types::tripleArray;
+using types::tripleArray2;
+using types::tripleArray3;
+using types::pathArray;
+using types::penArray;
+using types::penArray2;
+
+function *transformFunction()
+{
+  return new function(primTransform());
+}
+
+function *penFunction()
+{
+  return new function(primPen(),primInt(),primInt());
+}
+
+function *realRealRealFunction()
+{
+  return new function(primReal(),primReal(),primReal());
+}
+
+// Ignore unclosed begingroups but not spurious endgroups.
+const char *nobegin="endgroup without matching begingroup";
+  
+array *emptyarray=new array(0);
+
+array *nop(array *a) 
+{
+  return a;
+}
+  
+triple Zero;
+
+// A tensor-product Bezier patch awaiting depth-sorted vector output.
+struct shadepatch {
+  triple P[16];         // control points, P[4*i+j]
+  pen p[4];             // pens at P[0], P[12], P[15], and P[3]
+  size_t index;         // index of the original patch
+  unsigned edges;       // mask of edges lying on the original boundary
+  double depth;
+};
+
+typedef mem::vector<shadepatch> shadepatches;
+
+// Order patches from farthest to nearest, breaking ties like the former
+// interpreted sort.
+bool farther(const shadepatch& a, const shadepatch& b)
+{
+  return a.depth > b.depth || (a.depth == b.depth && a.index > b.index);
+}
+
+// Split the cubic Bezier curve with control points z[0], z[s], z[2s], z[3s]
+// at its midpoint.
+void splitcubic(const triple *z, size_t s, triple *left, triple *right)
+{
+  triple m0=0.5*(z[0]+z[s]);
+  triple m1=0.5*(z[s]+z[2*s]);
+  triple m2=0.5*(z[2*s]+z[3*s]);
+  triple m3=0.5*(m0+m1);
+  triple m4=0.5*(m1+m2);
+  triple m5=0.5*(m3+m4);
+  left[0]=z[0]; left[s]=m0; left[2*s]=m3; left[3*s]=m5;
+  right[0]=m5; right[s]=m4; right[2*s]=m2; right[3*s]=z[3*s];
+}
+
+// Return the maximum distance of the control points of P from those of the
+// bilinear patch through its corners, relative to the patch diameter.
+double nonflatness(const triple *P)
+{
+  triple p00=P[0], p30=P[12], p33=P[15], p03=P[3];
+  double d=std::max(length(p33-p00),length(p30-p03));
+  if(d == 0.0) return 0.0;
+  double M=0.0;
+  for(size_t i=0; i < 4; ++i) {
+    double u=i/3.0;
+    for(size_t j=0; j < 4; ++j) {
+      double v=j/3.0;
+      triple B=(1.0-u)*((1.0-v)*p00+v*p03)+u*((1.0-v)*p30+v*p33);
+      M=std::max(M,length(P[4*i+j]-B));
+    }
+  }
+  return M/d;
+}
+
+// Subdivide s until each piece is within the given relative flatness,
+// bilinearly interpolating the corner pens.
+void subdivide(const shadepatch& s, double flatness, unsigned depth,
+               shadepatches& out)
+{
+  if(depth == 0 || nonflatness(s.P) <= flatness) {
+    out.push_back(s);
+    return;
+  }
+  --depth;
+
+  triple L[16],R[16];
+  for(size_t j=0; j < 4; ++j)
+    splitcubic(s.P+j,4,L+j,R+j);
+
+  shadepatch q[4];
+  for(size_t i=0; i < 4; ++i) {
+    splitcubic(L+4*i,1,q[0].P+4*i,q[3].P+4*i);
+    splitcubic(R+4*i,1,q[1].P+4*i,q[2].P+4*i);
+  }
+
+  const pen *p=s.p;
+  pen m01=interpolate(p[0],p[1],0.5);
+  pen m12=interpolate(p[1],p[2],0.5);
+  pen m32=interpolate(p[3],p[2],0.5);
+  pen m03=interpolate(p[0],p[3],0.5);
+  pen c=interpolate(m01,m32,0.5);
+
+  q[0].p[0]=p[0]; q[0].p[1]=m01; q[0].p[2]=c; q[0].p[3]=m03;
+  q[1].p[0]=m01; q[1].p[1]=p[1]; q[1].p[2]=m12; q[1].p[3]=c;
+  q[2].p[0]=c; q[2].p[1]=m12; q[2].p[2]=p[2]; q[2].p[3]=m32;
+  q[3].p[0]=m03; q[3].p[1]=c; q[3].p[2]=m32; q[3].p[3]=p[3];
+
+  for(unsigned k=0; k < 4; ++k) {
+    q[k].index=s.index;
+    // Bit k denotes the edge starting at corner k.
+    q[k].edges=s.edges & ((1 << k) | (1 << ((k+3) % 4)));
+    subdivide(q[k],flatness,depth,out);
+  }
+}
+
+pair project(const triple& v, const double *T)
+{
+  double x=v.getx();
+  double y=v.gety();
+  double z=v.getz();
+  double f=T[12]*x+T[13]*y+T[14]*z+T[15];
+  if(f == 0.0) run::dividebyzero();
+  f=1.0/f;
+  return pair((T[0]*x+T[1]*y+T[2]*z+T[3])*f,(T[4]*x+T[5]*y+T[6]*z+T[7])*f);
+}
+
+// Return whether the control points of the cubic Bezier segment from z0 to
+// z1 lie at its thirds.
+bool straight(const pair& z0, const pair& c0, const pair& c1, const pair& z1)
+{
+  pair delta=(z1-z0)*third;
+  double fuzz=Fuzz*length(z1-z0);
+  return length(c0-(z0+delta)) <= fuzz && length(c1-(z1-delta)) <= fuzz;
+}
+
+// Corner and control point indices of the boundary edges, in the order of
+// the patch external() path.
+const size_t edgeindex[][4]={{0,4,8,12},{12,13,14,15},{15,11,7,3},
+                             {3,2,1,0}};
+
+// Autogenerated routines:
+
+
+
+#ifndef NOSYM
+#include "runpicture.symbols.h"
+
+#endif
+namespace run {
+#line 234 "runpicture.in"
+void newPicture(stack *Stack)
+{
+#line 235 "runpicture.in"
+  {Stack->push<picture*>(new picture()); return;}
+}
+
+#line 239 "runpicture.in"
+// bool empty(picture *f);
+void gen_runpicture1(stack *Stack)
+{
+  picture * f=vm::pop<picture *>(Stack);
+#line 240 "runpicture.in"
+  {Stack->push<bool>(f->null()); return;}
+}
+
+#line 244 "runpicture.in"
+// void erase(picture *f);
+void gen_runpicture2(stack *Stack)
+{
+  picture * f=vm::pop<picture *>(Stack);
+#line 245 "runpicture.in"
+  f->nodes.clear();
+}
+
+#line 249 "runpicture.in"
+// pair min(picture *f);
+void gen_runpicture3(stack *Stack)
+{
+  picture * f=vm::pop<picture *>(Stack);
+#line 250 "runpicture.in"
+  {Stack->push<pair>(f->bounds().Min()); return;}
+}
+
+#line 254 "runpicture.in"
+// pair max(picture *f);
+void gen_runpicture4(stack *Stack)
+{
+  picture * f=vm::pop<picture *>(Stack);
+#line 255 "runpicture.in"
+  {Stack->push<pair>(f->bounds().Max()); return;}
+}
+
+#line 259 "runpicture.in"
+// pair size(picture *f);
+void gen_runpicture5(stack *Stack)
+{
+  picture * f=vm::pop<picture *>(Stack);
+#line 260 "runpicture.in"
+  bbox b=f->bounds();
+  {Stack->push<pair>(b.Max()-b.Min()); return;}
+}
+
+#line 265 "runpicture.in"
+// void _draw(picture *f, path g, pen p);
+void gen_runpicture6(stack *Stack)
+{
+  pen p=vm::pop<pen>(Stack);
+  path g=vm::pop<path>(Stack);
+  picture * f=vm::pop<picture *>(Stack);
+#line 266 "runpicture.in"
+  f->append(new drawPath(g,p));
+}
+
+#line 270 "runpicture.in"
+// void fill(picture *f, patharray *g, pen p=CURRENTPEN, bool copy=true);
+void gen_runpicture7(stack *Stack)
+{
+  bool copy=vm::pop<bool>(Stack,true);
+  pen p=vm::pop<pen>(Stack,CURRENTPEN);
+  patharray * g=vm::pop<patharray *>(Stack);
+  picture * f=vm::pop<picture *>(Stack);
+#line 271 "runpicture.in"
+  array *(*copyarray)(array *a)=copy ? copyArray: nop;
+  f->append(new drawFill(*copyarray(g),false,p));
+}
+
+#line 276 "runpicture.in"
+// void latticeshade(picture *f, patharray *g, bool stroke=false,                  pen fillrule=CURRENTPEN, penarray2 *p, transform t=identity,                   bool copy=true);
+void gen_runpicture8(stack *Stack)
+{
+  bool copy=vm::pop<bool>(Stack,true);
+  transform t=vm::pop<transform>(Stack,identity);
+  penarray2 * p=vm::pop<penarray2 *>(Stack);
+  pen fillrule=vm::pop<pen>(Stack,CURRENTPEN);
+  bool stroke=vm::pop<bool>(Stack,false);
+  patharray * g=vm::pop<patharray *>(Stack);
+  picture * f=vm::pop<picture *>(Stack);
+#line 279 "runpicture.in"
+  array *(*copyarray)(array *a)=copy ? copyArray: nop;
+  f->append(new drawLatticeShade(*copyarray(g),stroke,fillrule,*copyarray(p),
+                                 t));
+}
+
+#line 285 "runpicture.in"
+// void axialshade(picture *f, patharray *g, bool stroke=false, pen pena, pair a,                bool extenda=true, pen penb, pair b, bool extendb=true,                bool copy=true);
+void gen_runpicture9(stack *Stack)
+{
+  bool copy=vm::pop<bool>(Stack,true);
+  bool extendb=vm::pop<bool>(Stack,true);
+  pair b=vm::pop<pair>(Stack);
+  pen penb=vm::pop<pen>(Stack);
+  bool extenda=vm::pop<bool>(Stack,true);
+  pair a=vm::pop<pair>(Stack);
+  pen pena=vm::pop<pen>(Stack);
+  bool stroke=vm::pop<bool>(Stack,false);
+  patharray * g=vm::pop<patharray *>(Stack);
+  picture * f=vm::pop<picture *>(Stack);
+#line 288 "runpicture.in"
+  array *(*copyarray)(array *a)=copy ? copyArray: nop;
+  f->append(new drawAxialShade(*copyarray(g),stroke,pena,a,extenda,penb,b,
+                               extendb));
+}
+
+#line 294 "runpicture.in"
+// void radialshade(picture *f, patharray *g, bool stroke=false, pen pena,                 pair a, real ra, bool extenda=true, pen penb, pair b, real rb,                 bool extendb=true, bool copy=true);
+void gen_runpicture10(stack *Stack)
+{
+  bool copy=vm::pop<bool>(Stack,true);
+  bool extendb=vm::pop<bool>(Stack,true);
+  real rb=vm::pop<real>(Stack);
+  pair b=vm::pop<pair>(Stack);
+  pen penb=vm::pop<pen>(Stack);
+  bool extenda=vm::pop<bool>(Stack,true);
+  real ra=vm::pop<real>(Stack);
+  pair a=vm::pop<pair>(Stack);
+  pen pena=vm::pop<pen>(Stack);
+  bool stroke=vm::pop<bool>(Stack,false);
+  patharray * g=vm::pop<patharray *>(Stack);
+  picture * f=vm::pop<picture *>(Stack);
+#line 297 "runpicture.in"
+  array *(*copyarray)(array *a)=copy ? copyArray: nop;
+  f->append(new drawRadialShade(*copyarray(g),stroke,pena,a,ra,extenda,
+                                penb,b,rb,extendb));
+}
+
+#line 303 "runpicture.in"
+// void gouraudshade(picture *f, patharray *g, bool stroke=false,                  pen fillrule=CURRENTPEN, penarray *p, pairarray *z,                  Intarray *edges, bool copy=true);
+void gen_runpicture11(stack *Stack)
+{
+  bool copy=vm::pop<bool>(Stack,true);
+  Intarray * edges=vm::pop<Intarray *>(Stack);
+  pairarray * z=vm::pop<pairarray *>(Stack);
+  penarray * p=vm::pop<penarray *>(Stack);
+  pen fillrule=vm::pop<pen>(Stack,CURRENTPEN);
+  bool stroke=vm::pop<bool>(Stack,false);
+  patharray * g=vm::pop<patharray *>(Stack);
+  picture * f=vm::pop<picture *>(Stack);
+#line 306 "runpicture.in"
+  array *(*copyarray)(array *a)=copy ? copyArray: nop;
+  checkArrays(p,z);
+  checkArrays(z,edges);
+  f->append(new drawGouraudShade(*copyarray(g),stroke,fillrule,*copyarray(p),
+                                 *copyarray(z),*copyarray(edges)));
+}
+
+#line 314 "runpicture.in"
+// void gouraudshade(picture *f, patharray *g, bool stroke=false,                  pen fillrule=CURRENTPEN, penarray *p, Intarray *edges,                  bool copy=true);
+void gen_runpicture12(stack *Stack)
+{
+  bool copy=vm::pop<bool>(Stack,true);
+  Intarray * edges=vm::pop<Intarray *>(Stack);
+  penarray * p=vm::pop<penarray *>(Stack);
+  pen fillrule=vm::pop<pen>(Stack,CURRENTPEN);
+  bool stroke=vm::pop<bool>(Stack,false);
+  patharray * g=vm::pop<patharray *>(Stack);
+  picture * f=vm::pop<picture *>(Stack);
+#line 317 "runpicture.in"
+  array *(*copyarray)(array *a)=copy ? copyArray: nop;
+  size_t n=checkArrays(p,edges);
+  size_t m=checkArray(g);
+  array *z=new array(n);
+  Int k=0;
+  Int in=(Int) n;
+  for(size_t j=0; j < m; ++j) {
+    path *P=read<path *>(g,j);
+    assert(P);
+    Int stop=Min(P->size(),in-k);
+    mem::vector<solvedKnot>& nodes=P->Nodes();
+    for(Int i=0; i < stop; ++i)
+      (*z)[k++]=nodes[i].point;
+  }
+  checkArrays(p,z);
+  
+  f->append(new drawGouraudShade(*copyarray(g),stroke,fillrule,*copyarray(p),
+                                 *z,*copyarray(edges)));
+}
+
+#line 338 "runpicture.in"
+// void tensorshade(picture *f, patharray *g, bool stroke=false,                 pen fillrule=CURRENTPEN, penarray2 *p, patharray *b=NULL,                 pairarray2 *z=emptyarray, bool copy=true);
+void gen_runpicture13(stack *Stack)
+{
+  bool copy=vm::pop<bool>(Stack,true);
+  pairarray2 * z=vm::pop<pairarray2 *>(Stack,emptyarray);
+  patharray * b=vm::pop<patharray *>(Stack,NULL);
+  penarray2 * p=vm::pop<penarray2 *>(Stack);
+  pen fillrule=vm::pop<pen>(Stack,CURRENTPEN);
+  bool stroke=vm::pop<bool>(Stack,false);
+  patharray * g=vm::pop<patharray *>(Stack);
+  picture * f=vm::pop<picture *>(Stack);
+#line 341 "runpicture.in"
+  array *(*copyarray)(array *a)=copy ? copyArray: nop;
+  array *(*copyarray2)(array *a)=copy ? copyArray2: nop;
+  if(b == NULL) b=g;
+  size_t n=checkArrays(p,b);
+  size_t nz=checkArray(z);
+  if(nz != 0)
+    checkEqual(nz,n);
+  f->append(new drawTensorShade(*copyarray(g),stroke,fillrule,*copyarray2(p),
+                                *copyarray(b),*copyarray2(z)));
+}
+
+// Append the tensor-product shadings of the Bezier patches P (each a 4x4
+// array of control points), projected with T and transformed by t, to f
+// from farthest to nearest along normal as seen from camera. The pens p[k]
+// correspond to the corners P[k][0][0], P[k][3][0], P[k][3][3], and
+// P[k][0][3]; fill[k] is the fill rule and a visible mesh[k] draws the
+// boundary of patch k. Patches that deviate from the bilinear patch through
+// their corners by more than flatness times their diameter are subdivided.
+#line 360 "runpicture.in"
+// void _shadesurface(picture *f, transform t, triplearray3 *P, penarray2 *p,                   penarray *fill, penarray *mesh, realarray2 *T,                   triple camera, triple normal, real flatness=0);
+void gen_runpicture14(stack *Stack)
+{
+  real flatness=vm::pop<real>(Stack,0);
+  triple normal=vm::pop<triple>(Stack);
+  triple camera=vm::pop<triple>(Stack);
+  realarray2 * T=vm::pop<realarray2 *>(Stack);
+  penarray * mesh=vm::pop<penarray *>(Stack);
+  penarray * fill=vm::pop<penarray *>(Stack);
+  penarray2 * p=vm::pop<penarray2 *>(Stack);
+  triplearray3 * P=vm::pop<triplearray3 *>(Stack);
+  transform t=vm::pop<transform>(Stack);
+  picture * f=vm::pop<picture *>(Stack);
+#line 363 "runpicture.in"
+  size_t n=checkArrays(P,p);
+  checkEqual(n,checkArray(fill));
+  checkEqual(n,checkArray(mesh));
+
+  const unsigned maxsubdivisions=8;
+  shadepatches patches;
+  patches.reserve(n);
+  shadepatch s;
+  for(size_t k=0; k < n; ++k) {
+    array *Pk=read<array*>(P,k);
+    checkEqual(checkArray(Pk),4);
+    for(size_t i=0; i < 4; ++i) {
+      array *Pki=read<array*>(Pk,i);
+      checkEqual(checkArray(Pki),4);
+      for(size_t j=0; j < 4; ++j)
+        s.P[4*i+j]=read<triple>(Pki,j);
+    }
+    array *pk=read<array*>(p,k);
+    checkEqual(checkArray(pk),4);
+    for(size_t i=0; i < 4; ++i)
+      s.p[i]=read<pen>(pk,i);
+    s.index=k;
+    s.edges=15;
+    if(flatness > 0.0)
+      subdivide(s,flatness,maxsubdivisions,patches);
+    else patches.push_back(s);
+  }
+
+  size_t N=patches.size();
+  for(size_t k=0; k < N; ++k) {
+    shadepatch& s=patches[k];
+    s.depth=dot(normal,camera-0.25*(s.P[0]+s.P[3]+s.P[12]+s.P[15]));
+  }
+  std::sort(patches.begin(),patches.end(),farther);
+
+  real *A;
+  copyArray2C(A,T,true,4);
+  
+  for(size_t k=0; k < N; ++k) {
+    shadepatch& s=patches[k];
+    pair z[16];
+    double x[16],y[16];
+    for(size_t i=0; i < 16; ++i) {
+      z[i]=project(s.P[i],A);
+      x[i]=z[i].getx();
+      y[i]=z[i].gety();
+    }
+
+    double fuzzx=sqrtFuzz*norm(x,16);
+    double fuzzy=sqrtFuzz*norm(y,16);
+    pair a=t*pair(bound(x,::min,x[0],fuzzx,maxdepth),
+                  bound(y,::min,y[0],fuzzy,maxdepth));
+    pair b=t*pair(bound(x,::max,x[0],fuzzx,maxdepth),
+                  bound(y,::max,y[0],fuzzy,maxdepth));
+    pair box[]={a,pair(b.getx(),a.gety()),b,pair(a.getx(),b.gety())};
+    mem::vector<solvedKnot> boxnodes(4);
+    for(size_t i=0; i < 4; ++i) {
+      solvedKnot& node=boxnodes[i];
+      pair delta=(box[(i+1) % 4]-box[i])*third;
+      node.point=box[i];
+      node.post=box[i]+delta;
+      boxnodes[(i+1) % 4].pre=box[(i+1) % 4]-delta;
+      node.straight=true;
+    }
+
+    for(size_t i=0; i < 16; ++i)
+      z[i]=t*z[i];
+
+    mem::vector<solvedKnot> nodes(4);
+    for(size_t i=0; i < 4; ++i) {
+      const size_t *e=edgeindex[i];
+      solvedKnot& node=nodes[i];
+      node.pre=z[edgeindex[(i+3) % 4][2]];
+      node.point=z[e[0]];
+      node.post=z[e[1]];
+      node.straight=straight(z[e[0]],z[e[1]],z[e[2]],z[e[3]]);
+    }
+    path boundary(nodes,4,true);
+
+    array g(1), pens(1), B(1), Z(1);
+    g[0]=path(boxnodes,4,true);
+    array *pk=new array(4);
+    for(size_t i=0; i < 4; ++i)
+      (*pk)[i]=s.p[i];
+    pens[0]=pk;
+    B[0]=boundary;
+    array *zk=new array(4);
+    (*zk)[0]=z[5];
+    (*zk)[1]=z[9];
+    (*zk)[2]=z[10];
+    (*zk)[3]=z[6];
+    Z[0]=zk;
+    f->append(new drawTensorShade(g,false,read<pen>(fill,s.index),pens,B,Z));
+
+    pen q=read<pen>(mesh,s.index);
+    if(!q.invisible()) {
+      if(s.edges == 15)
+        f->append(new drawPath(boundary,q));
+      else {
+        for(size_t i=0; i < 4; ++i) {
+          if(s.edges & (1 << i)) {
+            solvedKnot n0=nodes[i];
+            solvedKnot n1=nodes[(i+1) % 4];
+            n0.pre=n0.point;
+            n1.post=n1.point;
+            n1.straight=false;
+            f->append(new drawPath(path(n0,n1),q));
+          }
+        }
+      }
+    }
+  }
+  delete[] A;
+}
+
+#line 479 "runpicture.in"
+// void functionshade(picture *f, patharray *g, bool stroke=false,                   pen fillrule=CURRENTPEN, string shader=emptystring,                   bool copy=true);
+void gen_runpicture15(stack *Stack)
+{
+  bool copy=vm::pop<bool>(Stack,true);
+  string shader=vm::pop<string>(Stack,emptystring);
+  pen fillrule=vm::pop<pen>(Stack,CURRENTPEN);
+  bool stroke=vm::pop<bool>(Stack,false);
+  patharray * g=vm::pop<patharray *>(Stack);
+  picture * f=vm::pop<picture *>(Stack);
+#line 482 "runpicture.in"
+  array *(*copyarray)(array *a)=copy ? copyArray: nop;
+  f->append(new drawFunctionShade(*copyarray(g),stroke,fillrule,shader));
+}
+
+// Clip a picture to a superpath using the given fill rule.
+// Subsequent additions to the picture will not be affected by the clipping.
+#line 489 "runpicture.in"
+// void clip(picture *f, patharray *g, bool stroke=false,          pen fillrule=CURRENTPEN, bool copy=true);
+void gen_runpicture16(stack *Stack)
+{
+  bool copy=vm::pop<bool>(Stack,true);
+  pen fillrule=vm::pop<pen>(Stack,CURRENTPEN);
+  bool stroke=vm::pop<bool>(Stack,false);
+  patharray * g=vm::pop<patharray *>(Stack);
+  picture * f=vm::pop<picture *>(Stack);
+#line 491 "runpicture.in"
+  array *(*copyarray)(array *a)=copy ? copyArray: nop;
+  drawClipBegin *begin=new drawClipBegin(*copyarray(g),stroke,fillrule,true);
+  f->enclose(begin,new drawClipEnd(true,begin));
+}
+
+#line 497 "runpicture.in"
+// void beginclip(picture *f, patharray *g, bool stroke=false,               pen fillrule=CURRENTPEN, bool copy=true);
+void gen_runpicture17(stack *Stack)
+{
+  bool copy=vm::pop<bool>(Stack,true);
+  pen fillrule=vm::pop<pen>(Stack,CURRENTPEN);
+  bool stroke=vm::pop<bool>(Stack,false);
+  patharray * g=vm::pop<patharray *>(Stack);
+  picture * f=vm::pop<picture *>(Stack);
+#line 499 "runpicture.in"
+  array *(*copyarray)(array *a)=copy ? copyArray: nop;
+  f->append(new drawClipBegin(*copyarray(g),stroke,fillrule,false));
+}
+
+#line 504 "runpicture.in"
+// void endclip(picture *f);
+void gen_runpicture18(stack *Stack)
+{
+  picture * f=vm::pop<picture *>(Stack);
+#line 505 "runpicture.in"
+  f->append(new drawClipEnd(false));
+}
+
+#line 509 "runpicture.in"
+// void gsave(picture *f);
+void gen_runpicture19(stack *Stack)
+{
+  picture * f=vm::pop<picture *>(Stack);
+#line 510 "runpicture.in"
+  f->append(new drawGsave());
+}
+
+#line 514 "runpicture.in"
+// void grestore(picture *f);
+void gen_runpicture20(stack *Stack)
+{
+  picture * f=vm::pop<picture *>(Stack);
+#line 515 "runpicture.in"
+  f->append(new drawGrestore());
+}
+
+#line 519 "runpicture.in"
+// void begingroup(picture *f);
+void gen_runpicture21(stack *Stack)
+{
+  picture * f=vm::pop<picture *>(Stack);
+#line 520 "runpicture.in"
+  f->append(new drawBegin());
+}
+
+#line 524 "runpicture.in"
+// void endgroup(picture *f);
+void gen_runpicture22(stack *Stack)
+{
+  picture * f=vm::pop<picture *>(Stack);
+#line 525 "runpicture.in"
+  f->append(new drawEnd());
+}
+
+#line 529 "runpicture.in"
+// void _begingroup3(picture *f, string name, real compression,                 real granularity, bool closed, bool tessellate,                 bool dobreak, bool nobreak, triple center, Int interaction);
+void gen_runpicture23(stack *Stack)
+{
+  Int interaction=vm::pop<Int>(Stack);
+  triple center=vm::pop<triple>(Stack);
+  bool nobreak=vm::pop<bool>(Stack);
+  bool dobreak=vm::pop<bool>(Stack);
+  bool tessellate=vm::pop<bool>(Stack);
+  bool closed=vm::pop<bool>(Stack);
+  real granularity=vm::pop<real>(Stack);
+  real compression=vm::pop<real>(Stack);
+  string name=vm::pop<string>(Stack);
+  picture * f=vm::pop<picture *>(Stack);
+#line 532 "runpicture.in"
+  f->append(new drawBegin3(name,compression,granularity,
+                           closed,tessellate,dobreak,nobreak,
+                           center,(Interaction) intcast(interaction)));
+}
+
+#line 538 "runpicture.in"
+// void endgroup3(picture *f);
+void gen_runpicture24(stack *Stack)
+{
+  picture * f=vm::pop<picture *>(Stack);
+#line 539 "runpicture.in"
+  f->append(new drawEnd3());
+}
+
+#line 543 "runpicture.in"
+// void add(picture *dest, picture *src);
+void gen_runpicture25(stack *Stack)
+{
+  picture * src=vm::pop<picture *>(Stack);
+  picture * dest=vm::pop<picture *>(Stack);
+#line 544 "runpicture.in"
+  dest->add(*src);
+}
+
+#line 548 "runpicture.in"
+// void prepend(picture *dest, picture *src);
+void gen_runpicture26(stack *Stack)
+{
+  picture * src=vm::pop<picture *>(Stack);
+  picture * dest=vm::pop<picture *>(Stack);
+#line 549 "runpicture.in"
+  dest->prepend(*src);
+}
+
+#line 553 "runpicture.in"
+// void postscript(picture *f, string s);
+void gen_runpicture27(stack *Stack)
+{
+  string s=vm::pop<string>(Stack);
+  picture * f=vm::pop<picture *>(Stack);
+#line 554 "runpicture.in"
+  f->append(new drawVerbatim(PostScript,s));
+}
+
+#line 558 "runpicture.in"
+// void tex(picture *f, string s);
+void gen_runpicture28(stack *Stack)
+{
+  string s=vm::pop<string>(Stack);
+  picture * f=vm::pop<picture *>(Stack);
+#line 559 "runpicture.in"
+  f->append(new drawVerbatim(TeX,s));
+}
+
+#line 563 "runpicture.in"
+// void postscript(picture *f, string s, pair min, pair max);
+void gen_runpicture29(stack *Stack)
+{
+  pair max=vm::pop<pair>(Stack);
+  pair min=vm::pop<pair>(Stack);
+  string s=vm::pop<string>(Stack);
+  picture * f=vm::pop<picture *>(Stack);
+#line 564 "runpicture.in"
+  f->append(new drawVerbatim(PostScript,s,min,max));
+}
+
+#line 568 "runpicture.in"
+// void tex(picture *f, string s, pair min, pair max);
+void gen_runpicture30(stack *Stack)
+{
+  pair max=vm::pop<pair>(Stack);
+  pair min=vm::pop<pair>(Stack);
+  string s=vm::pop<string>(Stack);
+  picture * f=vm::pop<picture *>(Stack);
+#line 569 "runpicture.in"
+  f->append(new drawVerbatim(TeX,s,min,max));
+}
+
+#line 573 "runpicture.in"
+// void texpreamble(string s);
+void gen_runpicture31(stack *Stack)
+{
+  string s=vm::pop<string>(Stack);
+#line 574 "runpicture.in"
+  string t=s+"\n";
+  processDataStruct &pd=processData();
+  pd.TeXpipepreamble.push_back(t);
+  pd.TeXpreamble.push_back(t);
+}
+
+#line 581 "runpicture.in"
+// void deletepreamble();
+void gen_runpicture32(stack *)
+{
+#line 582 "runpicture.in"
+  if(getSetting<bool>("inlinetex")) {
+    unlink(buildname(outname(),"pre").c_str());
+  }
+}
+
+#line 588 "runpicture.in"
+// void _labelpath(picture *f, string s, string size, path g, string justify,                pair offset, pen p);
+void gen_runpicture33(stack *Stack)
+{
+  pen p=vm::pop<pen>(Stack);
+  pair offset=vm::pop<pair>(Stack);
+  string justify=vm::pop<string>(Stack);
+  path g=vm::pop<path>(Stack);
+  string size=vm::pop<string>(Stack);
+  string s=vm::pop<string>(Stack);
+  picture * f=vm::pop<picture *>(Stack);
+#line 590 "runpicture.in"
+  f->append(new drawLabelPath(s,size,g,justify,offset,p));
+}
+
+#line 594 "runpicture.in"
+// void texreset();
+void gen_runpicture34(stack *)
+{
+#line 595 "runpicture.in"
+  processDataStruct &pd=processData();
+  pd.TeXpipepreamble.clear();
+  pd.TeXpreamble.clear();
+  pd.tex.pipeclose();
+}
+
+#line 602 "runpicture.in"
+// void layer(picture *f);
+void gen_runpicture35(stack *Stack)
+{
+  picture * f=vm::pop<picture *>(Stack);
+#line 603 "runpicture.in"
+  f->append(new drawLayer());
+}
+
+#line 607 "runpicture.in"
+// void newpage(picture *f);
+void gen_runpicture36(stack *Stack)
+{
+  picture * f=vm::pop<picture *>(Stack);
+#line 608 "runpicture.in"
+  f->append(new drawNewPage());
+}
+
+#line 612 "runpicture.in"
+// void simplify(picture *f, real tolerance);
+void gen_runpicture37(stack *Stack)
+{
+  real tolerance=vm::pop<real>(Stack);
+  picture * f=vm::pop<picture *>(Stack);
+#line 613 "runpicture.in"
+  f->append(new drawSimplify(tolerance));
+}
+
+#line 617 "runpicture.in"
+// void _image(picture *f, realarray2 *data, pair initial, pair final,            penarray *palette=NULL, transform t=identity, bool copy=true,            bool antialias=false);
+void gen_runpicture38(stack *Stack)
+{
+  bool antialias=vm::pop<bool>(Stack,false);
+  bool copy=vm::pop<bool>(Stack,true);
+  transform t=vm::pop<transform>(Stack,identity);
+  penarray * palette=vm::pop<penarray *>(Stack,NULL);
+  pair final=vm::pop<pair>(Stack);
+  pair initial=vm::pop<pair>(Stack);
+  realarray2 * data=vm::pop<realarray2 *>(Stack);
+  picture * f=vm::pop<picture *>(Stack);
+#line 620 "runpicture.in"
+  array *(*copyarray)(array *a)=copy ? copyArray: nop;
+  array *(*copyarray2)(array *a)=copy ? copyArray2: nop;
+  f->append(new drawPaletteImage(*copyarray2(data),*copyarray(palette),
+                            t*matrix(initial,final),antialias));
+}
+
+#line 627 "runpicture.in"
+// void _image(picture *f, penarray2 *data, pair initial, pair final,            transform t=identity, bool copy=true, bool antialias=false);
+void gen_runpicture39(stack *Stack)
+{
+  bool antialias=vm::pop<bool>(Stack,false);
+  bool copy=vm::pop<bool>(Stack,true);
+  transform t=vm::pop<transform>(Stack,identity);
+  pair final=vm::pop<pair>(Stack);
+  pair initial=vm::pop<pair>(Stack);
+  penarray2 * data=vm::pop<penarray2 *>(Stack);
+  picture * f=vm::pop<picture *>(Stack);
+#line 629 "runpicture.in"
+  array *(*copyarray2)(array *a)=copy ? copyArray2: nop;
+  f->append(new drawNoPaletteImage(*copyarray2(data),t*matrix(initial,final),
+                                   antialias));
+}
+
+#line 635 "runpicture.in"
+// void _image(picture *f, callablePen *F, Int width, Int height,            pair initial, pair final, transform t=identity, bool antialias=false);
+void gen_runpicture40(stack *Stack)
+{
+  bool antialias=vm::pop<bool>(Stack,false);
+  transform t=vm::pop<transform>(Stack,identity);
+  pair final=vm::pop<pair>(Stack);
+  pair initial=vm::pop<pair>(Stack);
+  Int height=vm::pop<Int>(Stack);
+  Int width=vm::pop<Int>(Stack);
+  callablePen * F=vm::pop<callablePen *>(Stack);
+  picture * f=vm::pop<picture *>(Stack);
+#line 637 "runpicture.in"
+  f->append(new drawFunctionImage(Stack,F,width,height,
+                                  t*matrix(initial,final),antialias));
+}
+
+// Return the image data with f(x[i],y[j]) in row j and column i, evaluating
+// the function over the whole grid without interpreting the loops.
+#line 644 "runpicture.in"
+// realarray2* _sample(callableRealReal *f, realarray *x, realarray *y);
+void gen_runpicture41(stack *Stack)
+{
+  realarray * y=vm::pop<realarray *>(Stack);
+  realarray * x=vm::pop<realarray *>(Stack);
+  callableRealReal * f=vm::pop<callableRealReal *>(Stack);
+#line 645 "runpicture.in"
+  size_t nx=checkArray(x);
+  size_t ny=checkArray(y);
+  array *a=new array(ny);
+  for(size_t j=0; j < ny; ++j) {
+    double yj=read<double>(y,j);
+    array *aj=new array(nx);
+    for(size_t i=0; i < nx; ++i) {
+      Stack->push(read<double>(x,i));
+      Stack->push(yj);
+      f->call(Stack);
+      (*aj)[i]=pop<double>(Stack);
+    }
+    (*a)[j]=aj;
+  }
+  {Stack->push<realarray2*>(a); return;}
+}
+
+#line 663 "runpicture.in"
+// string nativeformat();
+void gen_runpicture42(stack *Stack)
+{
+#line 664 "runpicture.in"
+  {Stack->push<string>(nativeformat()); return;}
+}
+
+#line 668 "runpicture.in"
+// bool latex();
+void gen_runpicture43(stack *Stack)
+{
+#line 669 "runpicture.in"
+  {Stack->push<bool>(latex(getSetting<string>("tex"))); return;}
+}
+
+#line 673 "runpicture.in"
+// bool pdf();
+void gen_runpicture44(stack *Stack)
+{
+#line 674 "runpicture.in"
+  {Stack->push<bool>(pdf(getSetting<string>("tex"))); return;}
+}
+
+#line 678 "runpicture.in"
+// void shipout(string prefix=emptystring, picture *f, picture *preamble=NULL,             string format=emptystring, bool wait=false, bool view=true,             callableTransform *xform);
+void gen_runpicture45(stack *Stack)
+{
+  callableTransform * xform=vm::pop<callableTransform *>(Stack);
+  bool view=vm::pop<bool>(Stack,true);
+  bool wait=vm::pop<bool>(Stack,false);
+  string format=vm::pop<string>(Stack,emptystring);
+  picture * preamble=vm::pop<picture *>(Stack,NULL);
+  picture * f=vm::pop<picture *>(Stack);
+  string prefix=vm::pop<string>(Stack,emptystring);
+#line 681 "runpicture.in"
+  if(prefix.empty()) prefix=outname();
+
+  picture *result=new picture;
+  unsigned level=0;
+  picture::nodelist::iterator p;
+
+  // If null is given as an xform, just use the identity transformation.
+  bool xformIsNull = xform == nullfunc::instance();
+
+  for(p = f->nodes.begin(); p != f->nodes.end(); ++p) {
+    if (!xformIsNull)
+      xform->call(Stack);
+    transform t=xformIsNull ? camp::identity : pop<transform>(Stack);
+
+    static transform Zero=transform(0.0,0.0,0.0,0.0,0.0,0.0);
+    bool Delete=(t == Zero);
+    picture *group=new picture;
+    assert(*p);
+    if((*p)->endgroup()) error(nobegin);
+    if((*p)->begingroup()) {
+      ++level;
+      while(p != f->nodes.end() && level) {
+        if(!Delete) {
+          drawElement *e=t.isIdentity() ? *p : (*p)->transformed(t);
+          group->append(e);
+        }
+        ++p;
+        if(p == f->nodes.end()) break;
+        assert(*p);
+        if((*p)->begingroup()) ++level;
+        if((*p)->endgroup()) {
+          if(level) --level;
+          else error(nobegin);
+        }
+      }
+    }
+    if(p == f->nodes.end()) break;
+    assert(*p);
+    if(!Delete) {
+      drawElement *e=t.isIdentity() ? *p : (*p)->transformed(t);
+      group->append(e);
+      result->add(*group);
+    }
+  }
+    
+  result->shipout(preamble,prefix,format,0.0,wait,view);
+}
+
+#line 730 "runpicture.in"
+// void shipout3(string prefix, picture *f, string format=emptystring,              real width, real height, real angle, real zoom,              triple m, triple M, pair shift, realarray2 *t,              realarray *background, triplearray *lights, realarray2 *diffuse,              realarray2 *ambient, realarray2 *specular,              bool viewportlighting, bool view=true);
+void gen_runpicture46(stack *Stack)
+{
+  bool view=vm::pop<bool>(Stack,true);
+  bool viewportlighting=vm::pop<bool>(Stack);
+  realarray2 * specular=vm::pop<realarray2 *>(Stack);
+  realarray2 * ambient=vm::pop<realarray2 *>(Stack);
+  realarray2 * diffuse=vm::pop<realarray2 *>(Stack);
+  triplearray * lights=vm::pop<triplearray *>(Stack);
+  realarray * background=vm::pop<realarray *>(Stack);
+  realarray2 * t=vm::pop<realarray2 *>(Stack);
+  pair shift=vm::pop<pair>(Stack);
+  triple M=vm::pop<triple>(Stack);
+  triple m=vm::pop<triple>(Stack);
+  real zoom=vm::pop<real>(Stack);
+  real angle=vm::pop<real>(Stack);
+  real height=vm::pop<real>(Stack);
+  real width=vm::pop<real>(Stack);
+  string format=vm::pop<string>(Stack,emptystring);
+  picture * f=vm::pop<picture *>(Stack);
+  string prefix=vm::pop<string>(Stack);
+#line 736 "runpicture.in"
+  size_t n=checkArrays(lights,diffuse);
+  checkEqual(n,checkArray(ambient));
+  checkEqual(n,checkArray(specular));
+  
+  real *T,*Background,*Diffuse,*Ambient,*Specular;
+  triple *Lights;
+
+  copyArray2C(T,t,true,4);
+  copyArrayC(Background,background);
+  copyArrayC(Lights,lights);
+  copyArray2C(Diffuse,diffuse,false,4,UseGC);
+  copyArray2C(Ambient,ambient,false,4,UseGC);
+  copyArray2C(Specular,specular,false,4,UseGC);
+    
+  f->shipout3(prefix,format,width,height,angle,zoom,m,M,shift,T,Background,n,
+              Lights,Diffuse,Ambient,Specular,viewportlighting,view);
+  
+  delete[] Background;
+  delete[] T;
+}
+
+#line 758 "runpicture.in"
+// void shipout3(string prefix, picture *f);
+void gen_runpicture47(stack *Stack)
+{
+  picture * f=vm::pop<picture *>(Stack);
+  string prefix=vm::pop<string>(Stack);
+#line 759 "runpicture.in"
+  f->shipout3(prefix);
+}
+
+#line 763 "runpicture.in"
+// void deconstruct(picture *f, picture *preamble=NULL, real magnification=1,                  callableTransform *xform);
+void gen_runpicture48(stack *Stack)
+{
+  callableTransform * xform=vm::pop<callableTransform *>(Stack);
+  real magnification=vm::pop<real>(Stack,1);
+  picture * preamble=vm::pop<picture *>(Stack,NULL);
+  picture * f=vm::pop<picture *>(Stack);
+#line 765 "runpicture.in"
+  unsigned level=0;
+  unsigned n=0;
+
+  string prefix=outname();
+  const string xformat="png";
+
+  static long arg_max=sysconf(_SC_ARG_MAX);
+  const unsigned maxargs=::min(arg_max/(prefix.size()+xformat.size()+25ul),
+                               256ul);
+  openpipeout();
+
+  fprintf(pipeout,"%d\n",maxargs);
+  fflush(pipeout);
+  
+  string preformat=nativeformat();
+  const string Done="Done";
+  const string Error="Error";
+  
+  mem::vector<string> cmd;
+  
+  // Enforce ghostscript limitations.
+  magnification=::max(magnification,0.0001);
+  real res=::min(::max(magnification*72.0,2.0),8192.0);
+  
+  const char *converter=NULL, *hint=NULL;
+  
+  if(magnification > 0.0) {
+    mem::list<string> nameStack;
+    string outname;
+    unsigned arg=0;
+    unsigned batch=0;
+    for(picture::nodelist::iterator p=f->nodes.begin();;) {
+      if(p == f->nodes.end()) break;
+      if(arg == 0) {
+        cmd.clear();
+        ostringstream buf;
+        buf << batch << "_";
+        outname=buildname(prefix+buf.str()+"%d",xformat,"");
+        converter="gs";
+        hint="Ghostscript";
+        cmd.push_back(getSetting<string>(converter));
+        cmd.push_back("-q");
+        cmd.push_back("-dNOPAUSE");
+        cmd.push_back("-dBATCH");
+        cmd.push_back("-P");
+        cmd.push_back("-sDEVICE=pngalpha");
+        cmd.push_back("-dEPSCrop");
+        if(safe)
+          cmd.push_back("-dSAFER");
+        cmd.push_back("-r"+String(res)+"x"+String(res));
+        cmd.push_back("-sOutputFile="+outname);
+      }
+      
+      picture *group=new picture;
+      xform->call(Stack);
+      transform t=pop<transform>(Stack);
+      assert(*p);
+      if((*p)->endgroup()) {
+        fprintf(pipeout,"%s\n",Error.c_str());
+        fflush(pipeout);
+        error(nobegin);
+      }
+      if((*p)->begingroup()) {
+        ++level;
+        while(p != f->nodes.end() && level) {
+          drawElement *e=t.isIdentity() ? *p : (*p)->transformed(t);
+          group->append(e);
+          ++p;
+          if(p == f->nodes.end()) break;
+          assert(*p);
+          if((*p)->begingroup()) ++level;
+          if((*p)->endgroup()) {
+            if(level) --level;
+            else {
+              fprintf(pipeout,"%s\n",Error.c_str());
+              fflush(pipeout);
+              error(nobegin);
+            }
+          }
+        }
+      }
+      if(p != f->nodes.end()) {
+        assert(*p);
+        drawElement *e=t.isIdentity() ? *p : (*p)->transformed(t);
+        group->append(e);
+        bbox b;
+        ostringstream buf;
+        buf << prefix << "_" << n;
+        group->shipout(preamble,buf.str(),preformat,magnification,false,false);
+        string Preformat=group->Transparency() ? "pdf" : preformat;
+        string name=buildname(buf.str(),Preformat);
+        nameStack.push_back(name);
+        cmd.push_back(name);
+        b=group->bounds();
+        b *= magnification;
+      
+        const char *oldlocale=setlocale(LC_NUMERIC,NULL);
+        bool override=oldlocale && strcmp(oldlocale,"C") != 0;
+        if(override) {
+          oldlocale=StrdupNoGC(oldlocale);
+          setlocale(LC_NUMERIC,"C");
+        }
+        
+        fprintf(pipeout,"%g %g %g %g\n",b.left,b.right,b.bottom,b.top);
+        
+        if(override) {
+          setlocale(LC_NUMERIC,oldlocale);
+          delete[] oldlocale;
+        }
+        
+        fflush(pipeout);
+        ++n;
+        ++p;
+        ++arg;
+      }
+      
+      if(p == f->nodes.end() || arg >= maxargs) {
+        arg=0;
+        ++batch;
+        fflush(pipeout);
+  
+        int status=System(cmd,0,true,converter,hint);
+        if(status) {
+          fprintf(pipeout,"%s\n",Error.c_str());
+          fflush(pipeout);
+          error("deconstruct failed");
+        }
+      }
+    }
+    
+    if(!getSetting<bool>("keep")) {
+      for(mem::list<string>::iterator p=nameStack.begin();
+          p != nameStack.end(); ++p)
+        unlink(p->c_str());
+    }
+    
+    fprintf(pipeout,"%s\n",Done.c_str());
+    fflush(pipeout);
+  }
+}
+
+
+// Three-dimensional picture and surface operations
+
+// Bezier curve
+#line 911 "runpicture.in"
+// void _draw(picture *f, path3 g, triple center=Zero, pen p, Int interaction=0);
+void gen_runpicture49(stack *Stack)
+{
+  Int interaction=vm::pop<Int>(Stack,0);
+  pen p=vm::pop<pen>(Stack);
+  triple center=vm::pop<triple>(Stack,Zero);
+  path3 g=vm::pop<path3>(Stack);
+  picture * f=vm::pop<picture *>(Stack);
+#line 912 "runpicture.in"
+  if(g.size() > 0)
+    f->append(new drawPath3(g,center,p,(Interaction) intcast(interaction)));
+}
+
+// Bezier patch
+#line 918 "runpicture.in"
+// void draw(picture *f, triplearray2 *P, triple center, bool straight,          penarray *p, real opacity, real shininess, real PRCshininess,          triple normal, penarray *colors, Int interaction, bool prc=true);
+void gen_runpicture50(stack *Stack)
+{
+  bool prc=vm::pop<bool>(Stack,true);
+  Int interaction=vm::pop<Int>(Stack);
+  penarray * colors=vm::pop<penarray *>(Stack);
+  triple normal=vm::pop<triple>(Stack);
+  real PRCshininess=vm::pop<real>(Stack);
+  real shininess=vm::pop<real>(Stack);
+  real opacity=vm::pop<real>(Stack);
+  penarray * p=vm::pop<penarray *>(Stack);
+  bool straight=vm::pop<bool>(Stack);
+  triple center=vm::pop<triple>(Stack);
+  triplearray2 * P=vm::pop<triplearray2 *>(Stack);
+  picture * f=vm::pop<picture *>(Stack);
+#line 921 "runpicture.in"
+  f->append(new drawSurface(*P,center,straight,*p,opacity,shininess,
+                            PRCshininess,normal,*colors,
+                            (Interaction) intcast(interaction),prc));
+}
+
+// Bezier triangle
+#line 928 "runpicture.in"
+// void drawbeziertriangle(picture *f, triplearray2 *P, triple center,                        bool straight, penarray *p, real opacity,                        real shininess, real PRCshininess,                        penarray *colors, Int interaction, bool prc=true);
+void gen_runpicture51(stack *Stack)
+{
+  bool prc=vm::pop<bool>(Stack,true);
+  Int interaction=vm::pop<Int>(Stack);
+  penarray * colors=vm::pop<penarray *>(Stack);
+  real PRCshininess=vm::pop<real>(Stack);
+  real shininess=vm::pop<real>(Stack);
+  real opacity=vm::pop<real>(Stack);
+  penarray * p=vm::pop<penarray *>(Stack);
+  bool straight=vm::pop<bool>(Stack);
+  triple center=vm::pop<triple>(Stack);
+  triplearray2 * P=vm::pop<triplearray2 *>(Stack);
+  picture * f=vm::pop<picture *>(Stack);
+#line 932 "runpicture.in"
+  f->append(new drawBezierTriangle(*P,center,straight,*p,opacity,shininess,
+                                   PRCshininess,*colors,
+                                   (Interaction) intcast(interaction),prc));
+}
+
+// General NURBS curve
+#line 939 "runpicture.in"
+// void draw(picture *f, triplearray *P, realarray *knot,          realarray *weights=emptyarray, pen p);
+void gen_runpicture52(stack *Stack)
+{
+  pen p=vm::pop<pen>(Stack);
+  realarray * weights=vm::pop<realarray *>(Stack,emptyarray);
+  realarray * knot=vm::pop<realarray *>(Stack);
+  triplearray * P=vm::pop<triplearray *>(Stack);
+  picture * f=vm::pop<picture *>(Stack);
+#line 941 "runpicture.in"
+  f->append(new drawNurbsPath3(*P,knot,weights,p));
+}
+
+// General NURBS surface
+#line 946 "runpicture.in"
+// void draw(picture *f, triplearray2 *P, realarray *uknot, realarray *vknot,          realarray2 *weights=emptyarray, penarray *p, real opacity,          real shininess, real PRCshininess, penarray *colors);
+void gen_runpicture53(stack *Stack)
+{
+  penarray * colors=vm::pop<penarray *>(Stack);
+  real PRCshininess=vm::pop<real>(Stack);
+  real shininess=vm::pop<real>(Stack);
+  real opacity=vm::pop<real>(Stack);
+  penarray * p=vm::pop<penarray *>(Stack);
+  realarray2 * weights=vm::pop<realarray2 *>(Stack,emptyarray);
+  realarray * vknot=vm::pop<realarray *>(Stack);
+  realarray * uknot=vm::pop<realarray *>(Stack);
+  triplearray2 * P=vm::pop<triplearray2 *>(Stack);
+  picture * f=vm::pop<picture *>(Stack);
+#line 949 "runpicture.in"
+  f->append(new drawNurbs(*P,uknot,vknot,weights,*p,opacity,shininess,
+                          PRCshininess,*colors));
+}
+
+// PRC unit sphere
+#line 955 "runpicture.in"
+// void drawPRCsphere(picture *f, realarray2 *t, bool half=false, penarray *p,                   real opacity, real shininess, Int type);
+void gen_runpicture54(stack *Stack)
+{
+  Int type=vm::pop<Int>(Stack);
+  real shininess=vm::pop<real>(Stack);
+  real opacity=vm::pop<real>(Stack);
+  penarray * p=vm::pop<penarray *>(Stack);
+  bool half=vm::pop<bool>(Stack,false);
+  realarray2 * t=vm::pop<realarray2 *>(Stack);
+  picture * f=vm::pop<picture *>(Stack);
+#line 957 "runpicture.in"
+  f->append(new drawSphere(*t,half,*p,opacity,shininess,intcast(type)));
+}
+
+// PRC unit cylinder
+#line 962 "runpicture.in"
+// void drawPRCcylinder(picture *f, realarray2 *t, penarray *p, real opacity,                     real shininess);
+void gen_runpicture55(stack *Stack)
+{
+  real shininess=vm::pop<real>(Stack);
+  real opacity=vm::pop<real>(Stack);
+  penarray * p=vm::pop<penarray *>(Stack);
+  realarray2 * t=vm::pop<realarray2 *>(Stack);
+  picture * f=vm::pop<picture *>(Stack);
+#line 964 "runpicture.in"
+  f->append(new drawCylinder(*t,*p,opacity,shininess));
+}
+
+// PRC unit disk
+#line 969 "runpicture.in"
+// void drawPRCdisk(picture *f, realarray2 *t, penarray *p, real opacity,                 real shininess);
+void gen_runpicture56(stack *Stack)
+{
+  real shininess=vm::pop<real>(Stack);
+  real opacity=vm::pop<real>(Stack);
+  penarray * p=vm::pop<penarray *>(Stack);
+  realarray2 * t=vm::pop<realarray2 *>(Stack);
+  picture * f=vm::pop<picture *>(Stack);
+#line 971 "runpicture.in"
+  f->append(new drawDisk(*t,*p,opacity,shininess));
+}
+
+// General PRC tube
+#line 976 "runpicture.in"
+// void drawPRCtube(picture *f, path3 center, path3 g, penarray *p, real opacity,                 real shininess);
+void gen_runpicture57(stack *Stack)
+{
+  real shininess=vm::pop<real>(Stack);
+  real opacity=vm::pop<real>(Stack);
+  penarray * p=vm::pop<penarray *>(Stack);
+  path3 g=vm::pop<path3>(Stack);
+  path3 center=vm::pop<path3>(Stack);
+  picture * f=vm::pop<picture *>(Stack);
+#line 978 "runpicture.in"
+  f->append(new drawTube(center,g,*p,opacity,shininess));
+}
+
+// Draw pixel
+#line 983 "runpicture.in"
+// void drawpixel(picture *f, triple v, pen p, real width=1.0);
+void gen_runpicture58(stack *Stack)
+{
+  real width=vm::pop<real>(Stack,1.0);
+  pen p=vm::pop<pen>(Stack);
+  triple v=vm::pop<triple>(Stack);
+  picture * f=vm::pop<picture *>(Stack);
+#line 984 "runpicture.in"
+  f->append(new drawPixel(v,p,width));
+}
+
+// Draw triangles
+#line 989 "runpicture.in"
+// void draw(picture *f, triplearray *v, Intarray2 *vi,          triplearray *n, Intarray2 *ni,          penarray *p, real opacity, real shininess, real PRCshininess,          penarray *c=emptyarray, Intarray2 *ci=emptyarray);
+void gen_runpicture59(stack *Stack)
+{
+  Intarray2 * ci=vm::pop<Intarray2 *>(Stack,emptyarray);
+  penarray * c=vm::pop<penarray *>(Stack,emptyarray);
+  real PRCshininess=vm::pop<real>(Stack);
+  real shininess=vm::pop<real>(Stack);
+  real opacity=vm::pop<real>(Stack);
+  penarray * p=vm::pop<penarray *>(Stack);
+  Intarray2 * ni=vm::pop<Intarray2 *>(Stack);
+  triplearray * n=vm::pop<triplearray *>(Stack);
+  Intarray2 * vi=vm::pop<Intarray2 *>(Stack);
+  triplearray * v=vm::pop<triplearray *>(Stack);
+  picture * f=vm::pop<picture *>(Stack);
+#line 993 "runpicture.in"
+  f->append(new drawTriangles(*v,*vi,*n,*ni,*p,opacity,shininess,PRCshininess,
+                              *c,*ci));
+}
+
+#line 998 "runpicture.in"
+// triple min3(picture *f);
+void gen_runpicture60(stack *Stack)
+{
+  picture * f=vm::pop<picture *>(Stack);
+#line 999 "runpicture.in"
+  {Stack->push<triple>(f->bounds3().Min()); return;}
+}
+
+#line 1003 "runpicture.in"
+// triple max3(picture *f);
+void gen_runpicture61(stack *Stack)
+{
+  picture * f=vm::pop<picture *>(Stack);
+#line 1004 "runpicture.in"
+  {Stack->push<triple>(f->bounds3().Max()); return;}
+}
+
+#line 1008 "runpicture.in"
+// triple size3(picture *f);
+void gen_runpicture62(stack *Stack)
+{
+  picture * f=vm::pop<picture *>(Stack);
+#line 1009 "runpicture.in"
+  bbox3 b=f->bounds3();
+  {Stack->push<triple>(b.Max()-b.Min()); return;}
+}
+
+#line 1014 "runpicture.in"
+// pair minratio(picture *f);
+void gen_runpicture63(stack *Stack)
+{
+  picture * f=vm::pop<picture *>(Stack);
+#line 1015 "runpicture.in"
+  {Stack->push<pair>(f->ratio(::min)); return;}
+}
+
+#line 1019 "runpicture.in"
+// pair maxratio(picture *f);
+void gen_runpicture64(stack *Stack)
+{
+  picture * f=vm::pop<picture *>(Stack);
+#line 1020 "runpicture.in"
+  {Stack->push<pair>(f->ratio(::max)); return;}
+}
+
+#line 1024 "runpicture.in"
+// bool is3D(picture *f);
+void gen_runpicture65(stack *Stack)
+{
+  picture * f=vm::pop<picture *>(Stack);
+#line 1025 "runpicture.in"
+  {Stack->push<bool>(f->have3D()); return;}
+}
+
+} // namespace run
+
+namespace trans {
+
+void gen_runpicture_venv(venv &ve)
+{
+#line 234 "runpicture.in"
+  REGISTER_BLTIN(run::newPicture,"newPicture");
+#line 239 "runpicture.in"
+  addFunc(ve, run::gen_runpicture1, primBoolean(), SYM(empty), formal(primPicture(), SYM(f), false, false));
+#line 244 "runpicture.in"
+  addFunc(ve, run::gen_runpicture2, primVoid(), SYM(erase), formal(primPicture(), SYM(f), false, false));
+#line 249 "runpicture.in"
+  addFunc(ve, run::gen_runpicture3, primPair(), SYM(min), formal(primPicture(), SYM(f), false, false));
+#line 254 "runpicture.in"
+  addFunc(ve, run::gen_runpicture4, primPair(), SYM(max), formal(primPicture(), SYM(f), false, false));
+#line 259 "runpicture.in"
+  addFunc(ve, run::gen_runpicture5, primPair(), SYM(size), formal(primPicture(), SYM(f), false, false));
+#line 265 "runpicture.in"
+  addFunc(ve, run::gen_runpicture6, primVoid(), SYM(_draw), formal(primPicture(), SYM(f), false, false), formal(primPath(), SYM(g), false, false), formal(primPen(), SYM(p), false, false));
+#line 270 "runpicture.in"
+  addFunc(ve, run::gen_runpicture7, primVoid(), SYM(fill), formal(primPicture(), SYM(f), false, false), formal(pathArray()  , SYM(g), false, false), formal(primPen(), SYM(p), true, false), formal(primBoolean(), SYM(copy), true, false));
+#line 276 "runpicture.in"
+  addFunc(ve, run::gen_runpicture8, primVoid(), SYM(latticeshade), formal(primPicture(), SYM(f), false, false), formal(pathArray()  , SYM(g), false, false), formal(primBoolean(), SYM(stroke), true, false), formal(primPen(), SYM(fillrule), true, false), formal(penArray2()  , SYM(p), false, false), formal(primTransform(), SYM(t), true, false), formal(primBoolean(), SYM(copy), true, false));
+#line 285 "runpicture.in"
+  addFunc(ve, run::gen_runpicture9, primVoid(), SYM(axialshade), formal(primPicture(), SYM(f), false, false), formal(pathArray()  , SYM(g), false, false), formal(primBoolean(), SYM(stroke), true, false), formal(primPen(), SYM(pena), false, false), formal(primPair(), SYM(a), false, false), formal(primBoolean(), SYM(extenda), true, false), formal(primPen(), SYM(penb), false, false), formal(primPair(), SYM(b), false, false), formal(primBoolean(), SYM(extendb), true, false), formal(primBoolean(), SYM(copy), true, false));
+#line 294 "runpicture.in"
+  addFunc(ve, run::gen_runpicture10, primVoid(), SYM(radialshade), formal(primPicture(), SYM(f), false, false), formal(pathArray()  , SYM(g), false, false), formal(primBoolean(), SYM(stroke), true, false), formal(primPen(), SYM(pena), false, false), formal(primPair(), SYM(a), false, false), formal(primReal(), SYM(ra), false, false), formal(primBoolean(), SYM(extenda), true, false), formal(primPen(), SYM(penb), false, false), formal(primPair(), SYM(b), false, false), formal(primReal(), SYM(rb), false, false), formal(primBoolean(), SYM(extendb), true, false), formal(primBoolean(), SYM(copy), true, false));
+#line 303 "runpicture.in"
+  addFunc(ve, run::gen_runpicture11, primVoid(), SYM(gouraudshade), formal(primPicture(), SYM(f), false, false), formal(pathArray()  , SYM(g), false, false), formal(primBoolean(), SYM(stroke), true, false), formal(primPen(), SYM(fillrule), true, false), formal(penArray()  , SYM(p), false, false), formal(pairArray(), SYM(z), false, false), formal(IntArray(), SYM(edges), false, false), formal(primBoolean(), SYM(copy), true, false));
+#line 314 "runpicture.in"
+  addFunc(ve, run::gen_runpicture12, primVoid(), SYM(gouraudshade), formal(primPicture(), SYM(f), false, false), formal(pathArray()  , SYM(g), false, false), formal(primBoolean(), SYM(stroke), true, false), formal(primPen(), SYM(fillrule), true, false), formal(penArray()  , SYM(p), false, false), formal(IntArray(), SYM(edges), false, false), formal(primBoolean(), SYM(copy), true, false));
+#line 338 "runpicture.in"
+  addFunc(ve, run::gen_runpicture13, primVoid(), SYM(tensorshade), formal(primPicture(), SYM(f), false, false), formal(pathArray()  , SYM(g), false, false), formal(primBoolean(), SYM(stroke), true, false), formal(primPen(), SYM(fillrule), true, false), formal(penArray2()  , SYM(p), false, false), formal(pathArray()  , SYM(b), true, false), formal(pairArray2(), SYM(z), true, false), formal(primBoolean(), SYM(copy), true, false));
+#line 353 "runpicture.in"
+  addFunc(ve, run::gen_runpicture14, primVoid(), SYM(_shadesurface), formal(primPicture(), SYM(f), false, false), formal(primTransform(), SYM(t), false, false), formal(tripleArray3(), SYM(p), false, false), formal(penArray2()  , SYM(p), false, false), formal(penArray()  , SYM(fill), false, false), formal(penArray()  , SYM(mesh), false, false), formal(realArray2(), SYM(t), false, false), formal(primTriple(), SYM(camera), false, false), formal(primTriple(), SYM(normal), false, false), formal(primReal(), SYM(flatness), true, false));
+#line 479 "runpicture.in"
+  addFunc(ve, run::gen_runpicture15, primVoid(), SYM(functionshade), formal(primPicture(), SYM(f), false, false), formal(pathArray()  , SYM(g), false, false), formal(primBoolean(), SYM(stroke), true, false), formal(primPen(), SYM(fillrule), true, false), formal(primString() , SYM(shader), true, false), formal(primBoolean(), SYM(copy), true, false));
+#line 487 "runpicture.in"
+  addFunc(ve, run::gen_runpicture16, primVoid(), SYM(clip), formal(primPicture(), SYM(f), false, false), formal(pathArray()  , SYM(g), false, false), formal(primBoolean(), SYM(stroke), true, false), formal(primPen(), SYM(fillrule), true, false), formal(primBoolean(), SYM(copy), true, false));
+#line 497 "runpicture.in"
+  addFunc(ve, run::gen_runpicture17, primVoid(), SYM(beginclip), formal(primPicture(), SYM(f), false, false), formal(pathArray()  , SYM(g), false, false), formal(primBoolean(), SYM(stroke), true, false), formal(primPen(), SYM(fillrule), true, false), formal(primBoolean(), SYM(copy), true, false));
+#line 504 "runpicture.in"
+  addFunc(ve, run::gen_runpicture18, primVoid(), SYM(endclip), formal(primPicture(), SYM(f), false, false));
+#line 509 "runpicture.in"
+  addFunc(ve, run::gen_runpicture19, primVoid(), SYM(gsave), formal(primPicture(), SYM(f), false, false));
+#line 514 "runpicture.in"
+  addFunc(ve, run::gen_runpicture20, primVoid(), SYM(grestore), formal(primPicture(), SYM(f), false, false));
+#line 519 "runpicture.in"
+  addFunc(ve, run::gen_runpicture21, primVoid(), SYM(begingroup), formal(primPicture(), SYM(f), false, false));
+#line 524 "runpicture.in"
+  addFunc(ve, run::gen_runpicture22, primVoid(), SYM(endgroup), formal(primPicture(), SYM(f), false, false));
+#line 529 "runpicture.in"
+  addFunc(ve, run::gen_runpicture23, primVoid(), SYM(_begingroup3), formal(primPicture(), SYM(f), false, false), formal(primString() , SYM(name), false, false), formal(primReal(), SYM(compression), false, false), formal(primReal(), SYM(granularity), false, false), formal(primBoolean(), SYM(closed), false, false), formal(primBoolean(), SYM(tessellate), false, false), formal(primBoolean(), SYM(dobreak), false, false), formal(primBoolean(), SYM(nobreak), false, false), formal(primTriple(), SYM(center), false, false), formal(primInt(), SYM(interaction), false, false));
+#line 538 "runpicture.in"
+  addFunc(ve, run::gen_runpicture24, primVoid(), SYM(endgroup3), formal(primPicture(), SYM(f), false, false));
+#line 543 "runpicture.in"
+  addFunc(ve, run::gen_runpicture25, primVoid(), SYM(add), formal(primPicture(), SYM(dest), false, false), formal(primPicture(), SYM(src), false, false));
+#line 548 "runpicture.in"
+  addFunc(ve, run::gen_runpicture26, primVoid(), SYM(prepend), formal(primPicture(), SYM(dest), false, false), formal(primPicture(), SYM(src), false, false));
+#line 553 "runpicture.in"
+  addFunc(ve, run::gen_runpicture27, primVoid(), SYM(postscript), formal(primPicture(), SYM(f), false, false), formal(primString() , SYM(s), false, false));
+#line 558 "runpicture.in"
+  addFunc(ve, run::gen_runpicture28, primVoid(), SYM(tex), formal(primPicture(), SYM(f), false, false), formal(primString() , SYM(s), false, false));
+#line 563 "runpicture.in"
+  addFunc(ve, run::gen_runpicture29, primVoid(), SYM(postscript), formal(primPicture(), SYM(f), false, false), formal(primString() , SYM(s), false, false), formal(primPair(), SYM(min), false, false), formal(primPair(), SYM(max), false, false));
+#line 568 "runpicture.in"
+  addFunc(ve, run::gen_runpicture30, primVoid(), SYM(tex), formal(primPicture(), SYM(f), false, false), formal(primString() , SYM(s), false, false), formal(primPair(), SYM(min), false, false), formal(primPair(), SYM(max), false, false));
+#line 573 "runpicture.in"
+  addFunc(ve, run::gen_runpicture31, primVoid(), SYM(texpreamble), formal(primString() , SYM(s), false, false));
+#line 581 "runpicture.in"
+  addFunc(ve, run::gen_runpicture32, primVoid(), SYM(deletepreamble));
+#line 588 "runpicture.in"
+  addFunc(ve, run::gen_runpicture33, primVoid(), SYM(_labelpath), formal(primPicture(), SYM(f), false, false), formal(primString() , SYM(s), false, false), formal(primString() , SYM(size), false, false), formal(primPath(), SYM(g), false, false), formal(primString() , SYM(justify), false, false), formal(primPair(), SYM(offset), false, false), formal(primPen(), SYM(p), false, false));
+#line 594 "runpicture.in"
+  addFunc(ve, run::gen_runpicture34, primVoid(), SYM(texreset));
+#line 602 "runpicture.in"
+  addFunc(ve, run::gen_runpicture35, primVoid(), SYM(layer), formal(primPicture(), SYM(f), false, false));
+#line 607 "runpicture.in"
+  addFunc(ve, run::gen_runpicture36, primVoid(), SYM(newpage), formal(primPicture(), SYM(f), false, false));
+#line 612 "runpicture.in"
+  addFunc(ve, run::gen_runpicture37, primVoid(), SYM(simplify), formal(primPicture(), SYM(f), false, false), formal(primReal(), SYM(tolerance), false, false));
+#line 617 "runpicture.in"
+  addFunc(ve, run::gen_runpicture38, primVoid(), SYM(_image), formal(primPicture(), SYM(f), false, false), formal(realArray2(), SYM(data), false, false), formal(primPair(), SYM(initial), false, false), formal(primPair(), SYM(final), false, false), formal(penArray()  , SYM(palette), true, false), formal(primTransform(), SYM(t), true, false), formal(primBoolean(), SYM(copy), true, false), formal(primBoolean(), SYM(antialias), true, false));
+#line 627 "runpicture.in"
+  addFunc(ve, run::gen_runpicture39, primVoid(), SYM(_image), formal(primPicture(), SYM(f), false, false), formal(penArray2()  , SYM(data), false, false), formal(primPair(), SYM(initial), false, false), formal(primPair(), SYM(final), false, false), formal(primTransform(), SYM(t), true, false), formal(primBoolean(), SYM(copy), true, false), formal(primBoolean(), SYM(antialias), true, false));
+#line 635 "runpicture.in"
+  addFunc(ve, run::gen_runpicture40, primVoid(), SYM(_image), formal(primPicture(), SYM(f), false, false), formal(penFunction(), SYM(f), false, false), formal(primInt(), SYM(width), false, false), formal(primInt(), SYM(height), false, false), formal(primPair(), SYM(initial), false, false), formal(primPair(), SYM(final), false, false), formal(primTransform(), SYM(t), true, false), formal(primBoolean(), SYM(antialias), true, false));
+#line 642 "runpicture.in"
+  addFunc(ve, run::gen_runpicture41, realArray2(), SYM(_sample), formal(realRealRealFunction(), SYM(f), false, false), formal(realArray(), SYM(x), false, false), formal(realArray(), SYM(y), false, false));
+#line 663 "runpicture.in"
+  addFunc(ve, run::gen_runpicture42, primString() , SYM(nativeformat));
+#line 668 "runpicture.in"
+  addFunc(ve, run::gen_runpicture43, primBoolean(), SYM(latex));
+#line 673 "runpicture.in"
+  addFunc(ve, run::gen_runpicture44, primBoolean(), SYM(pdf));
+#line 678 "runpicture.in"
+  addFunc(ve, run::gen_runpicture45, primVoid(), SYM(shipout), formal(primString() , SYM(prefix), true, false), formal(primPicture(), SYM(f), false, false), formal(primPicture(), SYM(preamble), true, false), formal(primString() , SYM(format), true, false), formal(primBoolean(), SYM(wait), true, false), formal(primBoolean(), SYM(view), true, false), formal(transformFunction(), SYM(xform), false, false));
+#line 730 "runpicture.in"
+  addFunc(ve, run::gen_runpicture46, primVoid(), SYM(shipout3), formal(primString() , SYM(prefix), false, false), formal(primPicture(), SYM(f), false, false), formal(primString() , SYM(format), true, false), formal(primReal(), SYM(width), false, false), formal(primReal(), SYM(height), false, false), formal(primReal(), SYM(angle), false, false), formal(primReal(), SYM(zoom), false, false), formal(primTriple(), SYM(m), false, false), formal(primTriple(), SYM(m), false, false), formal(primPair(), SYM(shift), false, false), formal(realArray2(), SYM(t), false, false), formal(realArray(), SYM(background), false, false), formal(tripleArray(), SYM(lights), false, false), formal(realArray2(), SYM(diffuse), false, false), formal(realArray2(), SYM(ambient), false, false), formal(realArray2(), SYM(specular), false, false), formal(primBoolean(), SYM(viewportlighting), false, false), formal(primBoolean(), SYM(view), true, false));
+#line 758 "runpicture.in"
+  addFunc(ve, run::gen_runpicture47, primVoid(), SYM(shipout3), formal(primString() , SYM(prefix), false, false), formal(primPicture(), SYM(f), false, false));
+#line 763 "runpicture.in"
+  addFunc(ve, run::gen_runpicture48, primVoid(), SYM(deconstruct), formal(primPicture(), SYM(f), false, false), formal(primPicture(), SYM(preamble), true, false), formal(primReal(), SYM(magnification), true, false), formal(transformFunction(), SYM(xform), false, false));
+#line 907 "runpicture.in"
+  addFunc(ve, run::gen_runpicture49, primVoid(), SYM(_draw), formal(primPicture(), SYM(f), false, false), formal(primPath3(), SYM(g), false, false), formal(primTriple(), SYM(center), true, false), formal(primPen(), SYM(p), false, false), formal(primInt(), SYM(interaction), true, false));
+#line 917 "runpicture.in"
+  addFunc(ve, run::gen_runpicture50, primVoid(), SYM(draw), formal(primPicture(), SYM(f), false, false), formal(tripleArray2(), SYM(p), false, false), formal(primTriple(), SYM(center), false, false), formal(primBoolean(), SYM(straight), false, false), formal(penArray()  , SYM(p), false, false), formal(primReal(), SYM(opacity), false, false), formal(primReal(), SYM(shininess), false, false), formal(primReal(), SYM(prcshininess), false, false), formal(primTriple(), SYM(normal), false, false), formal(penArray()  , SYM(colors), false, false), formal(primInt(), SYM(interaction), false, false), formal(primBoolean(), SYM(prc), true, false));
+#line 927 "runpicture.in"
+  addFunc(ve, run::gen_runpicture51, primVoid(), SYM(drawbeziertriangle), formal(primPicture(), SYM(f), false, false), formal(tripleArray2(), SYM(p), false, false), formal(primTriple(), SYM(center), false, false), formal(primBoolean(), SYM(straight), false, false), formal(penArray()  , SYM(p), false, false), formal(primReal(), SYM(opacity), false, false), formal(primReal(), SYM(shininess), false, false), formal(primReal(), SYM(prcshininess), false, false), formal(penArray()  , SYM(colors), false, false), formal(primInt(), SYM(interaction), false, false), formal(primBoolean(), SYM(prc), true, false));
+#line 938 "runpicture.in"
+  addFunc(ve, run::gen_runpicture52, primVoid(), SYM(draw), formal(primPicture(), SYM(f), false, false), formal(tripleArray(), SYM(p), false, false), formal(realArray(), SYM(knot), false, false), formal(realArray(), SYM(weights), true, false), formal(primPen(), SYM(p), false, false));
+#line 945 "runpicture.in"
+  addFunc(ve, run::gen_runpicture53, primVoid(), SYM(draw), formal(primPicture(), SYM(f), false, false), formal(tripleArray2(), SYM(p), false, false), formal(realArray(), SYM(uknot), false, false), formal(realArray(), SYM(vknot), false, false), formal(realArray2(), SYM(weights), true, false), formal(penArray()  , SYM(p), false, false), formal(primReal(), SYM(opacity), false, false), formal(primReal(), SYM(shininess), false, false), formal(primReal(), SYM(prcshininess), false, false), formal(penArray()  , SYM(colors), false, false));
+#line 954 "runpicture.in"
+  addFunc(ve, run::gen_runpicture54, primVoid(), SYM(drawPRCsphere), formal(primPicture(), SYM(f), false, false), formal(realArray2(), SYM(t), false, false), formal(primBoolean(), SYM(half), true, false), formal(penArray()  , SYM(p), false, false), formal(primReal(), SYM(opacity), false, false), formal(primReal(), SYM(shininess), false, false), formal(primInt(), SYM(type), false, false));
+#line 961 "runpicture.in"
+  addFunc(ve, run::gen_runpicture55, primVoid(), SYM(drawPRCcylinder), formal(primPicture(), SYM(f), false, false), formal(realArray2(), SYM(t), false, false), formal(penArray()  , SYM(p), false, false), formal(primReal(), SYM(opacity), false, false), formal(primReal(), SYM(shininess), false, false));
+#line 968 "runpicture.in"
+  addFunc(ve, run::gen_runpicture56, primVoid(), SYM(drawPRCdisk), formal(primPicture(), SYM(f), false, false), formal(realArray2(), SYM(t), false, false), formal(penArray()  , SYM(p), false, false), formal(primReal(), SYM(opacity), false, false), formal(primReal(), SYM(shininess), false, false));
+#line 975 "runpicture.in"
+  addFunc(ve, run::gen_runpicture57, primVoid(), SYM(drawPRCtube), formal(primPicture(), SYM(f), false, false), formal(primPath3(), SYM(center), false, false), formal(primPath3(), SYM(g), false, false), formal(penArray()  , SYM(p), false, false), formal(primReal(), SYM(opacity), false, false), formal(primReal(), SYM(shininess), false, false));
+#line 982 "runpicture.in"
+  addFunc(ve, run::gen_runpicture58, primVoid(), SYM(drawpixel), formal(primPicture(), SYM(f), false, false), formal(primTriple(), SYM(v), false, false), formal(primPen(), SYM(p), false, false), formal(primReal(), SYM(width), true, false));
+#line 988 "runpicture.in"
+  addFunc(ve, run::gen_runpicture59, primVoid(), SYM(draw), formal(primPicture(), SYM(f), false, false), formal(tripleArray(), SYM(v), false, false), formal(IntArray2(), SYM(vi), false, false), formal(tripleArray(), SYM(n), false, false), formal(IntArray2(), SYM(ni), false, false), formal(penArray()  , SYM(p), false, false), formal(primReal(), SYM(opacity), false, false), formal(primReal(), SYM(shininess), false, false), formal(primReal(), SYM(prcshininess), false, false), formal(penArray()  , SYM(c), true, false), formal(IntArray2(), SYM(ci), true, false));
+#line 998 "runpicture.in"
+  addFunc(ve, run::gen_runpicture60, primTriple(), SYM(min3), formal(primPicture(), SYM(f), false, false));
+#line 1003 "runpicture.in"
+  addFunc(ve, run::gen_runpicture61, primTriple(), SYM(max3), formal(primPicture(), SYM(f), false, false));
+#line 1008 "runpicture.in"
+  addFunc(ve, run::gen_runpicture62, primTriple(), SYM(size3), formal(primPicture(), SYM(f), false, false));
+#line 1014 "runpicture.in"
+  addFunc(ve, run::gen_runpicture63, primPair(), SYM(minratio), formal(primPicture(), SYM(f), false, false));
+#line 1019 "runpicture.in"
+  addFunc(ve, run::gen_runpicture64, primPair(), SYM(maxratio), formal(primPicture(), SYM(f), false, false));
+#line 1024 "runpicture.in"
+  addFunc(ve, run::gen_runpicture65, primBoolean(), SYM(is3D), formal(primPicture(), SYM(f), false, false));
+}
+
+} // namespace trans
@@ -0,0 +1,149 @@
+/*****
+ * This file is automatically generated by findsym.pl
+ * Changes will be overwritten.
+ *****/
+
+// If the ADDSYMBOL macro is not already defined, define it with the default
+// purpose of referring to an external pre-translated symbol, such that
+// SYM(name) also refers to that symbol.
+#ifndef ADDSYMBOL
+    #define ADDSYMBOL(name) extern sym::symbol PRETRANSLATED_SYMBOL_##name
+    #define SYM(name) PRETRANSLATED_SYMBOL_##name
+#endif
+
+ADDSYMBOL(_begingroup3);
+ADDSYMBOL(_draw);
+ADDSYMBOL(_image);
+ADDSYMBOL(_labelpath);
+ADDSYMBOL(_sample);
+ADDSYMBOL(_shadesurface);
+ADDSYMBOL(a);
+ADDSYMBOL(add);
+ADDSYMBOL(ambient);
+ADDSYMBOL(angle);
+ADDSYMBOL(antialias);
+ADDSYMBOL(axialshade);
+ADDSYMBOL(b);
+ADDSYMBOL(background);
+ADDSYMBOL(beginclip);
+ADDSYMBOL(begingroup);
+ADDSYMBOL(c);
+ADDSYMBOL(camera);
+ADDSYMBOL(center);
+ADDSYMBOL(ci);
+ADDSYMBOL(clip);
+ADDSYMBOL(closed);
+ADDSYMBOL(colors);
+ADDSYMBOL(compression);
+ADDSYMBOL(copy);
+ADDSYMBOL(data);
+ADDSYMBOL(deconstruct);
+ADDSYMBOL(deletepreamble);
+ADDSYMBOL(dest);
+ADDSYMBOL(diffuse);
+ADDSYMBOL(dobreak);
+ADDSYMBOL(draw);
+ADDSYMBOL(drawPRCcylinder);
+ADDSYMBOL(drawPRCdisk);
+ADDSYMBOL(drawPRCsphere);
+ADDSYMBOL(drawPRCtube);
+ADDSYMBOL(drawbeziertriangle);
+ADDSYMBOL(drawpixel);
+ADDSYMBOL(edges);
+ADDSYMBOL(empty);
+ADDSYMBOL(endclip);
+ADDSYMBOL(endgroup);
+ADDSYMBOL(endgroup3);
+ADDSYMBOL(erase);
+ADDSYMBOL(extenda);
+ADDSYMBOL(extendb);
+ADDSYMBOL(f);
+ADDSYMBOL(fill);
+ADDSYMBOL(fillrule);
+ADDSYMBOL(final);
+ADDSYMBOL(flatness);
+ADDSYMBOL(format);
+ADDSYMBOL(functionshade);
+ADDSYMBOL(g);
+ADDSYMBOL(gouraudshade);
+ADDSYMBOL(granularity);
+ADDSYMBOL(grestore);
+ADDSYMBOL(gsave);
+ADDSYMBOL(half);
+ADDSYMBOL(height);
+ADDSYMBOL(initial);
+ADDSYMBOL(interaction);
+ADDSYMBOL(is3D);
+ADDSYMBOL(justify);
+ADDSYMBOL(knot);
+ADDSYMBOL(latex);
+ADDSYMBOL(latticeshade);
+ADDSYMBOL(layer);
+ADDSYMBOL(lights);
+ADDSYMBOL(m);
+ADDSYMBOL(magnification);
+ADDSYMBOL(max);
+ADDSYMBOL(max3);
+ADDSYMBOL(maxratio);
+ADDSYMBOL(mesh);
+ADDSYMBOL(min);
+ADDSYMBOL(min3);
+ADDSYMBOL(minratio);
+ADDSYMBOL(n);
+ADDSYMBOL(name);
+ADDSYMBOL(nativeformat);
+ADDSYMBOL(newpage);
+ADDSYMBOL(ni);
+ADDSYMBOL(nobreak);
+ADDSYMBOL(normal);
+ADDSYMBOL(offset);
+ADDSYMBOL(opacity);
+ADDSYMBOL(p);
+ADDSYMBOL(palette);
+ADDSYMBOL(pdf);
+ADDSYMBOL(pena);
+ADDSYMBOL(penb);
+ADDSYMBOL(postscript);
+ADDSYMBOL(prc);
+ADDSYMBOL(prcshininess);
+ADDSYMBOL(preamble);
+ADDSYMBOL(prefix);
+ADDSYMBOL(prepend);
+ADDSYMBOL(ra);
+ADDSYMBOL(radialshade);
+ADDSYMBOL(rb);
+ADDSYMBOL(s);
+ADDSYMBOL(shader);
+ADDSYMBOL(shift);
+ADDSYMBOL(shininess);
+ADDSYMBOL(shipout);
+ADDSYMBOL(shipout3);
+ADDSYMBOL(simplify);
+ADDSYMBOL(size);
+ADDSYMBOL(size3);
+ADDSYMBOL(specular);
+ADDSYMBOL(src);
+ADDSYMBOL(straight);
+ADDSYMBOL(stroke);
+ADDSYMBOL(t);
+ADDSYMBOL(tensorshade);
+ADDSYMBOL(tessellate);
+ADDSYMBOL(tex);
+ADDSYMBOL(texpreamble);
+ADDSYMBOL(texreset);
+ADDSYMBOL(tolerance);
+ADDSYMBOL(type);
+ADDSYMBOL(uknot);
+ADDSYMBOL(v);
+ADDSYMBOL(vi);
+ADDSYMBOL(view);
+ADDSYMBOL(viewportlighting);
+ADDSYMBOL(vknot);
+ADDSYMBOL(wait);
+ADDSYMBOL(weights);
+ADDSYMBOL(width);
+ADDSYMBOL(x);
+ADDSYMBOL(xform);
+ADDSYMBOL(y);
+ADDSYMBOL(z);
+ADDSYMBOL(zoom);
@@ -0,0 +1,9 @@
+/***** Autogenerated from runstring.in; changes will be overwritten *****/
+
+#ifndef runstring_H
+#define runstring_H
+namespace run {
+void emptyString(vm::stack *);
+}
+
+#endif // runstring_H
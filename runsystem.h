@@ -0,0 +1,8 @@
+/***** Autogenerated from runsystem.in; changes will be overwritten *****/
+
+#ifndef runsystem_H
+#define runsystem_H
+namespace run {
+}
+
+#endif // runsystem_H
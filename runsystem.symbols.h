@@ -0,0 +1,40 @@
+/*****
+ * This file is automatically generated by findsym.pl
+ * Changes will be overwritten.
+ *****/
+
+// If the ADDSYMBOL macro is not already defined, define it with the default
+// purpose of referring to an external pre-translated symbol, such that
+// SYM(name) also refers to that symbol.
+#ifndef ADDSYMBOL
+    #define ADDSYMBOL(name) extern sym::symbol PRETRANSLATED_SYMBOL_##name
+    #define SYM(name) PRETRANSLATED_SYMBOL_##name
+#endif
+
+ADDSYMBOL(animate);
+ADDSYMBOL(args);
+ADDSYMBOL(atbreakpoint);
+ADDSYMBOL(atexit);
+ADDSYMBOL(atupdate);
+ADDSYMBOL(breakpoint);
+ADDSYMBOL(breakpoints);
+ADDSYMBOL(clear);
+ADDSYMBOL(convert);
+ADDSYMBOL(divisor);
+ADDSYMBOL(f);
+ADDSYMBOL(file);
+ADDSYMBOL(format);
+ADDSYMBOL(line);
+ADDSYMBOL(locatefile);
+ADDSYMBOL(nowarn);
+ADDSYMBOL(outname);
+ADDSYMBOL(position);
+ADDSYMBOL(purge);
+ADDSYMBOL(s);
+ADDSYMBOL(stop);
+ADDSYMBOL(stripdirectory);
+ADDSYMBOL(stripextension);
+ADDSYMBOL(stripfile);
+ADDSYMBOL(t);
+ADDSYMBOL(warn);
+ADDSYMBOL(warning);
@@ -0,0 +1,38 @@
+/***** Autogenerated from runtime.in; changes will be overwritten *****/
+
+#ifndef runtime_H
+#define runtime_H
+namespace run {
+void IntZero(vm::stack *);
+void realZero(vm::stack *);
+void boolFalse(vm::stack *);
+void pushNullArray(vm::stack *);
+void pushNullRecord(vm::stack *);
+void pushNullFunction(vm::stack *);
+void pushDefault(vm::stack *);
+void isDefault(vm::stack *);
+void pairToGuide(vm::stack *);
+void pathToGuide(vm::stack *);
+void guideToPath(vm::stack *);
+void newPen(vm::stack *);
+void loadModule(vm::stack *);
+void nullGuide(vm::stack *);
+void dotsGuide(vm::stack *);
+void dashesGuide(vm::stack *);
+void newCycleToken(vm::stack *);
+void curlSpecifierValuePart(vm::stack *);
+void curlSpecifierSidePart(vm::stack *);
+void tensionSpecifierOutPart(vm::stack *);
+void tensionSpecifierInPart(vm::stack *);
+void tensionSpecifierAtleastPart(vm::stack *);
+void transformXPart(vm::stack *);
+void transformYPart(vm::stack *);
+void transformXXPart(vm::stack *);
+void transformXYPart(vm::stack *);
+void transformYXPart(vm::stack *);
+void transformYYPart(vm::stack *);
+void real6ToTransform(vm::stack *);
+void transformIdentity(vm::stack *);
+}
+
+#endif // runtime_H
@@ -1164,6 +1164,11 @@ void initSettings() {
   addOption(new boolSetting("keep", 'k', "Keep intermediate files"));
   addOption(new boolSetting("keepaux", 0,
                             "Keep intermediate LaTeX .aux files"));
+  addOption(new boolSetting("texpathcache", 0,
+                            "Cache texpath and textpath outlines on disk"));
+  addOption(new boolSetting("freetype", 0,
+                            "Outline TeX fonts for texpath with FreeType",
+                            true));
   addOption(new engineSetting("tex", 0, "engine",
                               "latex|pdflatex|xelatex|lualatex|tex|pdftex|luatex|context|none",
                               "latex"));
@@ -1254,6 +1259,21 @@ void initSettings() {
   addOption(new boolSetting("autorotate", 0,
                             "Enable automatic PDF page rotation",
                             false));
+  addOption(new boolSetting("pdfwriter", 0,
+                            "Write PDF files without labels directly",
+                            true));
+  addOption(new IntSetting("jobs", 0, "n",
+                           "Concurrent shipout jobs (0=number of processors)",
+                           1));
+  addOption(new boolSetting("pngwriter", 0,
+                            "Rasterize PNG files without labels directly",
+                            true));
+  addOption(new realSetting("simplify", 0, "bp",
+                            "Path simplification tolerance (0=disable)",
+                            0.0));
+  addOption(new boolSetting("svgwriter", 0,
+                            "Write SVG files without labels directly",
+                            true));
   addOption(new boolSetting("pdfreload", 0,
                             "Automatically reload document in pdfviewer",
                             false));
@@ -1277,6 +1297,9 @@ void initSettings() {
                             30.0));
   addOption(new realSetting("framedelay", 0, "ms",
                             "Additional frame delay", 0.0));
+  addOption(new realSetting("framebudget", 0, "ms",
+                            "Interactive frame time budget (0=disable)",
+                            0.0));
   addOption(new realSetting("arcballradius", 0, "pixels",
                             "Arcball radius", 750.0));
   addOption(new realSetting("resizestep", 0, "step", "Resize step", 1.2));
@@ -60,6 +60,7 @@ extern const string suffix;
 extern const string guisuffix;
 extern const string standardprefix;
   
+extern string initdir;
 extern string historyname;
   
 void SetPageDimensions();
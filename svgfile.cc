@@ -0,0 +1,437 @@
+/*****
+ * svgfile.cc
+ *
+ * Writes pictures without labels directly to an SVG file.
+ *****/
+
+#include "svgfile.h"
+#include "pngfile.h"
+#include "settings.h"
+#include "errormsg.h"
+
+using vm::array;
+using vm::read;
+
+namespace camp {
+
+// Paths with at most this many segments are shared between identical uses.
+static const size_t sharedsegments=32;
+
+// The width, in SVG units (PostScript points), of a line drawn with a pen of
+// width zero: one CSS pixel, the thinnest line that viewers reliably show.
+static const double hairline=0.75;
+
+svgfile::svgfile(const string& filename)
+  : psfile(filename,false), supported(true), groups(0), ids(0)
+{
+}
+
+svgfile::~svgfile()
+{
+}
+
+void svgfile::prologue(const bbox& box)
+{
+  this->box=box;
+  double width=box.right-box.left;
+  double height=box.top-box.bottom;
+  current.T=transform(-box.left,box.top,1.0,0.0,0.0,-1.0);
+  current.groups=0;
+  current.opacity=1.0;
+
+  *out << "<?xml version=\"1.0\" encoding=\"UTF-8\"?>" << newl
+       << "<!-- Created by " << settings::PROGRAM << " "
+       << settings::VERSION << REVISION << " -->" << newl
+       << "<svg xmlns=\"http://www.w3.org/2000/svg\""
+       << " xmlns:xlink=\"http://www.w3.org/1999/xlink\" version=\"1.1\""
+       << " width=\"";
+  writenumber(*out,width);
+  *out << "pt\" height=\"";
+  writenumber(*out,height);
+  *out << "pt\" viewBox=\"0 0";
+  write(width);
+  write(height);
+  *out << "\">" << newl;
+}
+
+void svgfile::epilogue()
+{
+  for(; groups > 0; --groups)
+    *out << "</g>" << newl;
+  *out << "</svg>" << newl;
+}
+
+void svgfile::setopacity(const pen& p)
+{
+  string blend=p.blend();
+  if(blend != "Compatible" && blend != "Normal") unsupported();
+  current.opacity=p.opacity();
+  if(p.opacity() != 1.0) transparency=true;
+  lastpen.settransparency(p);
+}
+
+void svgfile::setpen(pen p)
+{
+  p.convert();
+  setopacity(p);
+  if(!p.fillpattern().empty()) unsupported();
+  lastpen=p;
+}
+
+void svgfile::gsave(bool)
+{
+  pens.push(lastpen);
+  states.push(current);
+  simplifystates.push(std::make_pair(tolerance,linear));
+}
+
+void svgfile::grestore(bool)
+{
+  if(states.size() < 1)
+    reportError("grestore without matching gsave");
+  lastpen=pens.top();
+  pens.pop();
+  current=states.top();
+  states.pop();
+  tolerance=simplifystates.top().first;
+  linear=simplifystates.top().second;
+  simplifystates.pop();
+  for(; groups > current.groups; --groups)
+    *out << "</g>" << newl;
+}
+
+void svgfile::add(char type, const pair& z0, const pair& z1, const pair& z2)
+{
+  segment s;
+  s.type=type;
+  const transform& T=current.T;
+  s.z[0]=T*z0;
+  s.z[1]=T*z1;
+  s.z[2]=T*z2;
+  segments.push_back(s);
+}
+
+string svgfile::pathdata(const transform& t, const pair& origin)
+{
+  ostringstream buf;
+  buf.precision(out->precision());
+  for(size_t i=0; i < segments.size(); ++i) {
+    const segment& s=segments[i];
+    buf << s.type;
+    size_t n=s.type == 'C' ? 3 : s.type == 'Z' ? 0 : 1;
+    for(size_t j=0; j < n; ++j) {
+      pair z=t*s.z[j]-origin;
+      if(j > 0) buf << " ";
+      writenumber(buf,z.getx());
+      buf << " ";
+      writenumber(buf,z.gety());
+    }
+  }
+  return buf.str();
+}
+
+void svgfile::color(const char *attribute, const pen& p)
+{
+  pen q=p;
+  q.torgb();
+  *out << " " << attribute << "=\"#" << q.hex() << "\"";
+}
+
+void svgfile::opacity(const char *attribute, double opacity)
+{
+  if(opacity == 1.0) return;
+  *out << " " << attribute << "=\"";
+  writenumber(*out,opacity);
+  *out << "\"";
+}
+
+void svgfile::outpath(const string& attributes, bool shared)
+{
+  if(segments.empty()) return;
+
+  if(shared && segments.size() <= sharedsegments) {
+    // Markers and dots typically repeat a short path at different offsets.
+    pair origin=segments[0].z[0];
+    string d=pathdata(identity,origin);
+    mem::map<CONST string,size_t>::iterator p=defined.find(d);
+    size_t id;
+    if(p == defined.end()) {
+      id=++ids;
+      defined[d]=id;
+      *out << "<defs><path id=\"p" << id << "\" d=\"" << d << "\"/></defs>"
+           << newl;
+    } else id=p->second;
+    *out << "<use xlink:href=\"#p" << id << "\" x=\"";
+    writenumber(*out,origin.getx());
+    *out << "\" y=\"";
+    writenumber(*out,origin.gety());
+    *out << "\"" << attributes << "/>" << newl;
+  } else {
+    *out << "<path d=\"" << pathdata(identity,pair(0,0)) << "\""
+         << attributes << "/>" << newl;
+  }
+  newpath();
+}
+
+void svgfile::stroke(const pen& p, bool dot)
+{
+  // As in PostScript, a dot is a zero-length line, drawn by its caps.
+  if(dot && segments.size() == 1) {
+    segment s=segments[0];
+    s.type='L';
+    segments.push_back(s);
+  }
+
+  ostringstream attributes;
+  attributes.precision(out->precision());
+  ostream *o=out;
+  out=&attributes;
+  *out << " fill=\"none\"";
+  color("stroke",p);
+  opacity("stroke-opacity",p.opacity());
+
+  // The stroke is drawn in the current coordinates, which may include a
+  // pen transform.
+  const transform& T=current.T;
+  bool plain=T.getxx() == 1.0 && T.getxy() == 0.0 && T.getyx() == 0.0 &&
+    T.getyy() == -1.0;
+
+  double width=p.width();
+  if(width == 0.0) {
+    double det=fabs(T.getxx()*T.getyy()-T.getxy()*T.getyx());
+    width=plain || det == 0.0 ? hairline : hairline/sqrt(det);
+  }
+  *out << " stroke-width=\"";
+  writenumber(*out,width);
+  *out << "\"";
+  if(p.cap() != 0)
+    *out << " stroke-linecap=\"" << PSCap[p.cap()] << "\"";
+  if(p.join() != 0)
+    *out << " stroke-linejoin=\"" << Join[p.join()] << "\"";
+  if(p.join() == 0 && p.miter() != 4.0) {
+    *out << " stroke-miterlimit=\"";
+    writenumber(*out,p.miter());
+    *out << "\"";
+  }
+
+  const LineType *linetype=p.linetype();
+  size_t n=linetype->pattern.size();
+  if(n > 0) {
+    *out << " stroke-dasharray=\"";
+    for(size_t i=0; i < n; ++i) {
+      if(i > 0) *out << ",";
+      writenumber(*out,read<double>(linetype->pattern,i));
+    }
+    *out << "\"";
+    if(linetype->offset != 0.0) {
+      *out << " stroke-dashoffset=\"";
+      writenumber(*out,linetype->offset);
+      *out << "\"";
+    }
+  }
+  out=o;
+
+  if(plain || !T.invertible())
+    outpath(attributes.str(),true);
+  else {
+    *out << "<path d=\"" << pathdata(inverse(T),pair(0,0))
+         << "\" transform=\"matrix(";
+    writenumber(*out,T.getxx());
+    write(T.getyx());
+    write(T.getxy());
+    write(T.getyy());
+    write(T.getx());
+    write(T.gety());
+    *out << ")\"" << attributes.str() << "/>" << newl;
+    newpath();
+  }
+}
+
+void svgfile::fill(const pen& p)
+{
+  ostringstream attributes;
+  attributes.precision(out->precision());
+  ostream *o=out;
+  out=&attributes;
+  color("fill",p);
+  opacity("fill-opacity",p.opacity());
+  if(p.evenodd())
+    *out << " fill-rule=\"evenodd\"";
+  out=o;
+  outpath(attributes.str(),true);
+}
+
+void svgfile::endclip(const pen& p)
+{
+  size_t id=++ids;
+  *out << "<clipPath id=\"c" << id << "\"><path d=\""
+       << pathdata(identity,pair(0,0)) << "\"";
+  if(p.evenodd())
+    *out << " clip-rule=\"evenodd\"";
+  *out << "/></clipPath>" << newl
+       << "<g clip-path=\"url(#c" << id << ")\">" << newl;
+  ++groups;
+  current.groups=groups;
+  newpath();
+}
+
+void svgfile::cover(const string& paint)
+{
+  *out << "<rect width=\"";
+  writenumber(*out,box.right-box.left);
+  *out << "\" height=\"";
+  writenumber(*out,box.top-box.bottom);
+  *out << "\" fill=\"" << paint << "\"";
+  opacity("opacity",current.opacity);
+  *out << "/>" << newl;
+}
+
+void svgfile::gradientshade(bool axial, ColorSpace colorspace,
+                            const pen& pena, const pair& a, double ra,
+                            bool extenda, const pen& penb, const pair& b,
+                            double rb, bool extendb)
+{
+  setopacity(pena);
+
+  // SVG gradients always extend beyond both ends, and SVG 1.1 radial
+  // gradients start from a focal point inside the outer circle; an inner
+  // circle is expressed by the first stop only if the circles are concentric.
+  if(!extenda || !extendb ||
+     (!axial && (length(b-a) > rb || ra < 0.0 || ra > rb ||
+                 (ra > 0.0 && a != b)))) {
+    unsupported();
+    return;
+  }
+
+  size_t id=++ids;
+  const transform& T=current.T;
+  *out << "<defs><" << (axial ? "linear" : "radial") << "Gradient id=\"g"
+       << id << "\" gradientUnits=\"userSpaceOnUse\"";
+  if(axial) {
+    *out << " x1=\"";
+    writenumber(*out,a.getx());
+    *out << "\" y1=\"";
+    writenumber(*out,a.gety());
+    *out << "\" x2=\"";
+    writenumber(*out,b.getx());
+    *out << "\" y2=\"";
+    writenumber(*out,b.gety());
+  } else {
+    *out << " fx=\"";
+    writenumber(*out,a.getx());
+    *out << "\" fy=\"";
+    writenumber(*out,a.gety());
+    *out << "\" cx=\"";
+    writenumber(*out,b.getx());
+    *out << "\" cy=\"";
+    writenumber(*out,b.gety());
+    *out << "\" r=\"";
+    writenumber(*out,rb);
+  }
+  *out << "\" gradientTransform=\"matrix(";
+  writenumber(*out,T.getxx());
+  write(T.getyx());
+  write(T.getxy());
+  write(T.getyy());
+  write(T.getx());
+  write(T.gety());
+  *out << ")\">" << newl << "<stop offset=\"";
+  writenumber(*out,axial || ra == 0.0 ? 0.0 : ra/rb);
+  *out << "\"";
+  color("stop-color",pena);
+  *out << "/>" << newl << "<stop offset=\"1\"";
+  color("stop-color",penb);
+  *out << "/>" << newl << "</" << (axial ? "linear" : "radial")
+       << "Gradient></defs>" << newl;
+
+  ostringstream paint;
+  paint << "url(#g" << id << ")";
+  cover(paint.str());
+}
+
+void svgfile::imageheader(size_t width, size_t height, ColorSpace colorspace)
+{
+  imagewidth=width;
+  imageheight=height;
+  imagecolorspace=colorspace;
+}
+
+encoder *svgfile::newencoder()
+{
+  imagedata.clear();
+  imagedata.reserve(ColorComponents[imagecolorspace]*imagewidth*imageheight);
+  return new collect(imagedata);
+}
+
+static const char *base64=
+  "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+static void encode64(ostream& out, const string& s)
+{
+  size_t n=s.size();
+  const unsigned char *a=(const unsigned char *) s.data();
+  char buf[4];
+  for(size_t i=0; i < n; i += 3) {
+    unsigned int v=a[i] << 16;
+    if(i+1 < n) v |= a[i+1] << 8;
+    if(i+2 < n) v |= a[i+2];
+    buf[0]=base64[(v >> 18) & 63];
+    buf[1]=base64[(v >> 12) & 63];
+    buf[2]=i+1 < n ? base64[(v >> 6) & 63] : '=';
+    buf[3]=i+2 < n ? base64[v & 63] : '=';
+    out.write(buf,4);
+  }
+}
+
+void svgfile::outImage()
+{
+  size_t ncomponents=ColorComponents[imagecolorspace];
+  std::vector<unsigned char> data;
+  data.swap(imagedata);
+
+  // Convert to filtered PNG scanlines, in RGB unless the image is gray.
+  bool gray=ncomponents == 1;
+  size_t m=imagewidth, n=imageheight;
+  size_t rowbytes=(gray ? 1 : 3)*m+1;
+  std::vector<unsigned char> png(rowbytes*n);
+  const unsigned char *b=&data[0];
+  for(size_t i=0; i < n; ++i) {
+    unsigned char *row=&png[rowbytes*i];
+    *(row++)=0;
+    for(size_t j=0; j < m; ++j, b += ncomponents) {
+      if(ncomponents == 4) {
+        unsigned int k=255-b[3];
+        for(size_t l=0; l < 3; ++l)
+          *(row++)=(unsigned char) ((255-b[l])*k/255);
+      } else
+        for(size_t l=0; l < ncomponents; ++l)
+          *(row++)=b[l];
+    }
+  }
+
+  ostringstream s;
+  writePNG(s,m,n,gray ? 0 : 2,png);
+
+  // Images occupy the unit square, with their first row at the bottom.
+  // Unless antialiased, they are shown with sharp pixel boundaries; the
+  // SVG 1.1 value is kept as a fallback for viewers without pixelated.
+  const transform& T=current.T;
+  *out << "<image width=\"1\" height=\"1\" preserveAspectRatio=\"none\"";
+  if(!antialias)
+    *out << " style=\"image-rendering:optimizeSpeed;"
+         << "image-rendering:pixelated\"";
+  *out << " transform=\"matrix(";
+  writenumber(*out,T.getxx());
+  write(T.getyx());
+  write(T.getxy());
+  write(T.getyy());
+  write(T.getx());
+  write(T.gety());
+  *out << ")\"";
+  opacity("opacity",current.opacity);
+  *out << " xlink:href=\"data:image/png;base64,";
+  encode64(*out,s.str());
+  *out << "\"/>" << newl;
+}
+
+} //namespace camp
@@ -0,0 +1,128 @@
+/*****
+ * svgfile.h
+ *
+ * Writes pictures without labels directly to an SVG file.
+ *****/
+
+#ifndef SVGFILE_H
+#define SVGFILE_H
+
+#include <vector>
+
+#include "psfile.h"
+
+namespace camp {
+
+class svgfile : public psfile {
+  struct state {
+    transform T;        // maps user to SVG coordinates
+    size_t groups;      // number of open clipping groups
+    double opacity;
+  };
+
+  // A path segment in SVG coordinates.
+  struct segment {
+    char type;          // M, L, C, or Z
+    pair z[3];
+  };
+
+  bbox box;
+  bool supported;
+
+  state current;
+  mem::stack<state> states;
+  size_t groups;
+
+  std::vector<segment> segments;
+  size_t ids;           // number of element identifiers used
+
+  // Identifiers of short paths already defined, indexed by their path data
+  // relative to the first point.
+  mem::map<CONST string,size_t> defined;
+
+  size_t imagewidth,imageheight;
+  ColorSpace imagecolorspace;
+  std::vector<unsigned char> imagedata;
+
+  void add(char type, const pair& z0, const pair& z1=pair(),
+           const pair& z2=pair());
+
+  // Return the path data of the current path, mapped by the transform t
+  // and shifted by -origin.
+  string pathdata(const transform& t, const pair& origin);
+
+  void color(const char *attribute, const pen& p);
+  void opacity(const char *attribute, double opacity);
+
+  // Output the current path with the given presentation attributes,
+  // referring to an earlier identical path where possible.
+  void outpath(const string& attributes, bool shared);
+
+  // Cover the current clipping region with the given paint.
+  void cover(const string& paint);
+
+public:
+  svgfile(const string& filename);
+  ~svgfile();
+
+  // Could every element be represented directly in SVG?
+  bool Supported() {return supported;}
+
+  void unsupported() {supported=false;}
+
+  void prologue(const bbox& box);
+  void epilogue();
+
+  void setpen(pen p);
+  void setopacity(const pen& p);
+
+  void newpath() {segments.clear();}
+  void moveto(pair z) {add('M',z);}
+  void lineto(pair z) {add('L',z);}
+  void curveto(pair zp, pair zm, pair z1) {add('C',zp,zm,z1);}
+  void closepath() {add('Z',pair());}
+
+  void stroke(const pen &p, bool dot=false);
+  void strokepath() {unsupported();}
+  void fill(const pen &p);
+
+  void beginclip() {newpath();}
+  void endclip(const pen &p);
+
+  void latticeshade(const vm::array& a, const transform& t) {unsupported();}
+  void gradientshade(bool axial, ColorSpace colorspace,
+                     const pen& pena, const pair& a, double ra,
+                     bool extenda, const pen& penb, const pair& b,
+                     double rb, bool extendb);
+  void gouraudshade(const pen& pentype, const vm::array& pens,
+                    const vm::array& vertices, const vm::array& edges) {
+    unsupported();
+  }
+  void tensorshade(const pen& pentype, const vm::array& pens,
+                   const vm::array& boundaries, const vm::array& z) {
+    unsupported();
+  }
+
+  void imageheader(size_t width, size_t height, ColorSpace colorspace);
+  encoder *newencoder();
+  void outImage();
+
+  void gsave(bool tex=false);
+  void grestore(bool tex=false);
+
+  void translate(pair z) {
+    current.T=current.T*shift(z);
+  }
+
+  void concat(transform t) {
+    current.T=current.T*t;
+    linear=linear*shiftless(t);
+  }
+
+  void verbatimline(const string&) {unsupported();}
+  void verbatim(const string&) {unsupported();}
+};
+
+} //namespace camp
+
+#endif
@@ -368,6 +368,7 @@ void svgtexfile::gsave(bool)
     clipstack.push(clipcount);
   *out << "\\special{dvisvgm:raw <g>}%" << newl;
   pens.push(lastpen);
+  simplifystates.push(std::make_pair(tolerance,linear));
 }
   
 void svgtexfile::grestore(bool)
@@ -376,6 +377,9 @@ void svgtexfile::grestore(bool)
     reportError("grestore without matching gsave");
   lastpen=pens.top();
   pens.pop();
+  tolerance=simplifystates.top().first;
+  linear=simplifystates.top().second;
+  simplifystates.pop();
   clipstack.pop();
   *out << "\\special{dvisvgm:raw </g>}%" << newl;
 }
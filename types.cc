@@ -164,6 +164,7 @@ trans::varEntry *primitiveTy::virtualField(symbol id, signature *sig)
       FILEFIELD(primBoolean,modeType,singlereal,SYM(singlereal));
       FILEFIELD(primBoolean,modeType,singleint,SYM(singleint));
       FILEFIELD(primBoolean,modeType,signedint,SYM(signedint));
+      FILEFIELD(primBoolean,modeType,prefetch,SYM(prefetch));
       SIGFIELD(readType,SYM(read),readSet);
       break;
     default:
@@ -200,7 +201,8 @@ ty *primitiveTy::virtualFieldGetType(symbol id)
   
     if (id == SYM(line) || id == SYM(csv) || 
         id == SYM(word) || id == SYM(singlereal) || 
-        id == SYM(singleint) || id == SYM(signedint))
+        id == SYM(singleint) || id == SYM(signedint) ||
+        id == SYM(prefetch))
       return overloadedModeType();
   
     if (id == SYM(read))
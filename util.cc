@@ -438,3 +438,58 @@ Int Intcast(unsignedInt n)
     vm::error(intrange);
   return (Int) n;
 }
+
+size_t helperthreads=0;
+
+size_t threadcount(size_t size, size_t grain)
+{
+  size_t n=1;
+#ifdef HAVE_PTHREAD
+  if(getSetting<bool>("threads")) {
+    long nproc=sysconf(_SC_NPROCESSORS_ONLN);
+    if(nproc > 1) n=std::min((size_t) nproc,(size_t) 16);
+  }
+#endif
+  return std::min(n,std::max(size/grain,(size_t) 1));
+}
+
+#ifdef HAVE_PTHREAD
+struct task {
+  void (*f)(void *, size_t);
+  void *arg;
+  size_t i;
+};
+
+static void *runTask(void *t)
+{
+  task *T=(task *) t;
+  T->f(T->arg,T->i);
+  return NULL;
+}
+#endif
+
+void parallel(size_t n, void (*f)(void *arg, size_t i), void *arg)
+{
+#ifdef HAVE_PTHREAD
+  if(n > 1) {
+    std::vector<task> tasks(n);
+    std::vector<pthread_t> thread(n);
+    std::vector<bool> started(n,false);
+    for(size_t i=1; i < n; ++i) {
+      task& t=tasks[i];
+      t.f=f;
+      t.arg=arg;
+      t.i=i;
+      started[i]=pthread_create(&thread[i],NULL,runTask,&t) == 0;
+    }
+    f(arg,0);
+    for(size_t i=1; i < n; ++i) {
+      if(started[i]) pthread_join(thread[i],NULL);
+      else f(arg,i);
+    }
+    return;
+  }
+#endif
+  for(size_t i=0; i < n; ++i)
+    f(arg,i);
+}
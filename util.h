@@ -152,4 +152,15 @@ unsignedInt unsignedIntcast(Int n);
 int intcast(Int n);
 Int Intcast(unsignedInt n);
 
+// Return the number of threads to use for size units of work, giving each
+// thread at least grain units.
+size_t threadcount(size_t size, size_t grain);
+
+// Call f(arg,i) for i=0,...,n-1, each on its own thread where possible.
+void parallel(size_t n, void (*f)(void *arg, size_t i), void *arg);
+
+// The number of long-lived threads, such as those prefetching input or
+// draining output, started by the interpreter and still running.
+extern size_t helperthreads;
+
 #endif
@@ -153,6 +153,25 @@ public:
     if(x.byte() == EOF) set(eofbit);
     return *this;
   }
+  
+  // Read n consecutive values of a 4 or 8 byte XDR type, returning the
+  // number read.
+  template<class T>
+  size_t read(T *x, size_t n) {
+    size_t m=fread(x,sizeof(T),n,buf);
+    if(m < n) set(eofbit);
+    const int one=1;
+    if(*(const char *) &one) {
+      unsigned char *p=(unsigned char *) x;
+      for(size_t i=0; i < m; ++i, p += sizeof(T))
+        for(size_t j=0; j < sizeof(T)/2; ++j) {
+          unsigned char c=p[j];
+          p[j]=p[sizeof(T)-1-j];
+          p[sizeof(T)-1-j]=c;
+        }
+    }
+    return m;
+  }
 };
 
 class oxstream : virtual public xstream {